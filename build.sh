@@ -11,24 +11,22 @@ echo "## Build performance test"
 mkdir build
 cd build
 cmake ..
-cmake --build . --target performance-none32 
-cmake --build . --target performance-an32 
-cmake --build . --target performance-onecmp32
-cmake --build . --target performance-twocmp32
-cmake --build . --target performance-res32
-cmake --build . --target performance-none64
-cmake --build . --target performance-an64 
-cmake --build . --target performance-onecmp64
-cmake --build . --target performance-twocmp64
-cmake --build . --target performance-res64
+cmake --build . --target genrand
+cmake --build . --target performance
 
 echo "## Build validation test"
 cmake .. -DVAL_TIME=True 
 cmake  --build . --target val-mul 
 cmake  --build . --target val-mul-enc 
+cmake  --build . --target val-mul-ckpt 
+for CODING in none32 none64 an32 an64 an32df an64df an64limb onecmp32 onecmp64 twocmp32 twocmp64 res32 res64 resbl32 resbl64; do
+cmake  --build . --target val-gemm-$CODING
+cmake  --build . --target val-ctrl-$CODING
+done
 
 
 echo "## Build fault sim and metrics test"
 cmake --build . --target detcap
+cmake --build . --target detcap-mc
 
 cd ..
\ No newline at end of file
@@ -20,6 +20,9 @@
 #include <stdint.h>
 #include <stdlib.h>
 #include "common.h"
+#include "batch.h"
+#include "checkpoint.h"
+#include "an_param.h"
 #define ENCODING_NAME "AN_32BIT"
 
 // A for encoding AN in 32bits
@@ -146,103 +149,67 @@ AC_INLINE uint32c1_t u_mod_32c1(uint32c1_t x_c1, uint32c1_t y_c1)
 
 AC_INLINE int32c1_t eq_32c1(int32c1_t x_c1, int32c1_t y_c1)
 {
-	int32c1_t r_c1 = 0;
-	if (x_c1 == y_c1) {
-		r_c1 = A1_32;
-	}
+	int32c1_t r_c1 = A1_32 & AC_MASK(int32c1_t, x_c1 == y_c1);
 	return r_c1;
 }
 AC_INLINE uint32c1_t u_eq_32c1(uint32c1_t x_c1, uint32c1_t y_c1)
 {
-	uint32c1_t r_c1 = 0;
-	if (x_c1 == y_c1) {
-		r_c1 = A1_32;
-	}
+	uint32c1_t r_c1 = A1_32 & AC_MASK(uint32c1_t, x_c1 == y_c1);
 	return r_c1;
 }
 
 AC_INLINE int32c1_t neq_32c1(int32c1_t x_c1, int32c1_t y_c1)
 {
-	int32c1_t r_c1 = 0;
-	if (x_c1 != y_c1) {
-		r_c1 = A1_32;
-	}
+	int32c1_t r_c1 = A1_32 & AC_MASK(int32c1_t, x_c1 != y_c1);
 	return r_c1;
 }
 AC_INLINE uint32c1_t u_neq_32c1(uint32c1_t x_c1, uint32c1_t y_c1)
 {
-	uint32c1_t r_c1 = 0;
-	if (x_c1 != y_c1) {
-		r_c1 = A1_32;
-	}
+	uint32c1_t r_c1 = A1_32 & AC_MASK(uint32c1_t, x_c1 != y_c1);
 	return r_c1;
 }
 
 AC_INLINE int32c1_t less_32c1(int32c1_t x_c1, int32c1_t y_c1)
 {
-	int32c1_t r_c1 = 0;
-	if (x_c1 < y_c1) {
-		r_c1 = A1_32;
-	}
+	int32c1_t r_c1 = A1_32 & AC_MASK(int32c1_t, x_c1 < y_c1);
 	return r_c1;
 }
 AC_INLINE uint32c1_t u_less_32c1(uint32c1_t x_c1, uint32c1_t y_c1)
 {
-	uint32c1_t r_c1 = 0;
-	if (x_c1 < y_c1) {
-		r_c1 = A1_32;
-	}
+	uint32c1_t r_c1 = A1_32 & AC_MASK(uint32c1_t, x_c1 < y_c1);
 	return r_c1;
 }
 
 AC_INLINE int32c1_t grt_32c1(int32c1_t x_c1, int32c1_t y_c1)
 {
-	int32c1_t r_c1 = 0;
-	if (x_c1 > y_c1) {
-		r_c1 = A1_32;
-	}
+	int32c1_t r_c1 = A1_32 & AC_MASK(int32c1_t, x_c1 > y_c1);
 	return r_c1;
 }
 AC_INLINE uint32c1_t u_grt_32c1(uint32c1_t x_c1, uint32c1_t y_c1)
 {
-	uint32c1_t r_c1 = 0;
-	if (x_c1 > y_c1) {
-		r_c1 = A1_32;
-	}
+	uint32c1_t r_c1 = A1_32 & AC_MASK(uint32c1_t, x_c1 > y_c1);
 	return r_c1;
 }
 
 AC_INLINE int32c1_t leq_32c1(int32c1_t x_c1, int32c1_t y_c1)
 {
-	int32c1_t r_c1 = 0;
-	if (x_c1 <= y_c1) {
-		r_c1 = A1_32;
-	}
+	int32c1_t r_c1 = A1_32 & AC_MASK(int32c1_t, x_c1 <= y_c1);
 	return r_c1;
 }
 AC_INLINE uint32c1_t u_leq_32c1(uint32c1_t x_c1, uint32c1_t y_c1)
 {
-	uint32c1_t r_c1 = 0;
-	if (x_c1 <= y_c1) {
-		r_c1 = A1_32;
-	}
+	uint32c1_t r_c1 = A1_32 & AC_MASK(uint32c1_t, x_c1 <= y_c1);
 	return r_c1;
 }
 
 AC_INLINE int32c1_t geq_32c1(int32c1_t x_c1, int32c1_t y_c1)
 {
-	int32c1_t r_c1 = 0;
-	if (x_c1 >= y_c1) {
-		r_c1 = A1_32;
-	}
+	int32c1_t r_c1 = A1_32 & AC_MASK(int32c1_t, x_c1 >= y_c1);
 	return r_c1;
 }
 AC_INLINE uint32c1_t u_geq_32c1(uint32c1_t x_c1, uint32c1_t y_c1)
 {
-	uint32c1_t r_c1 = 0;
-	if (x_c1 >= y_c1) {
-		r_c1 = A1_32;
-	}
+	uint32c1_t r_c1 = A1_32 & AC_MASK(uint32c1_t, x_c1 >= y_c1);
 	return r_c1;
 }
 
@@ -276,17 +243,13 @@ AC_INLINE uint32c1_t u_shr_32c1(uint32c1_t x_c1, uint32c1_t y_c1)
 AC_INLINE int32c1_t land_32c1(int32c1_t x_c1, int32c1_t y_c1)
 {
 	int32c1_t r_c1 = mul_32c1(x_c1, y_c1);
-	if (r_c1 != 0) {
-		r_c1 = A1_32;
-	}
+	r_c1 = A1_32 & AC_MASK(int32c1_t, r_c1 != 0);
 	return r_c1;
 }
 AC_INLINE uint32c1_t u_land_32c1(uint32c1_t x_c1, uint32c1_t y_c1)
 {
 	uint32c1_t r_c1 = u_mul_32c1(x_c1, y_c1);
-	if (r_c1 != 0) {
-		r_c1 = A1_32;
-	}
+	r_c1 = A1_32 & AC_MASK(uint32c1_t, r_c1 != 0);
 	return r_c1;
 }
 /*	OR Table
@@ -298,30 +261,14 @@ AC_INLINE uint32c1_t u_land_32c1(uint32c1_t x_c1, uint32c1_t y_c1)
  */
 AC_INLINE int32c1_t lor_32c1(int32c1_t x_c1, int32c1_t y_c1)
 {
-	int32c1_t r_c1 = x_c1 + y_c1;
-	if (r_c1 != 0) {
-		r_c1 = A1_32;
-	}
-	//Force true if one value is negative. For x=-n and y=n the addition is 0 but the result is true
-	if (x_c1 < 0) {
-		r_c1 = A1_32;
-	}
-	if (y_c1 < 0) {
-		r_c1 = A1_32;
-	}
+	//x + y can wrap to 0 although the result is true, so the operands are tested directly
+	int32c1_t r_c1 = A1_32 & AC_MASK(int32c1_t, (x_c1 | y_c1) != 0);
 	return r_c1;
 }
 AC_INLINE uint32c1_t u_lor_32c1(uint32c1_t x_c1, uint32c1_t y_c1)
 {
-	uint32c1_t r_c1 = x_c1 + y_c1;
-	if (r_c1 != 0) {
-		r_c1 = A1_32;
-	} else {
-		//Force true if overlow is detected. AS the overlow can lead to a 0 which would be intepreted as False
-		if (r_c1 < x_c1 && r_c1 < y_c1) {
-			r_c1 = A1_32;
-		}
-	}
+	//x + y can wrap to 0 although the result is true, so the operands are tested directly
+	uint32c1_t r_c1 = A1_32 & AC_MASK(uint32c1_t, (x_c1 | y_c1) != 0);
 	return r_c1;
 }
 
@@ -391,4 +338,80 @@ AC_INLINE uint32c1_t u_xor_32c1(uint32c1_t x_c1, uint32c1_t y_c1)
 	return r_c1;
 }
 
+#ifdef AC_BATCH_HAS_AVX2
+// AVX2 kernels of the batch operations, 4 code words per vector
+AC_BATCH_AVX2 size_t add_32c1_v256(const int32c1_t *x, const int32c1_t *y,
+				   int32c1_t *r, size_t n)
+{
+	size_t i = 0;
+	for (; i + 4 <= n; i += 4) {
+		__m256i xv = _mm256_loadu_si256((const __m256i *)(x + i));
+		__m256i yv = _mm256_loadu_si256((const __m256i *)(y + i));
+		_mm256_storeu_si256((__m256i *)(r + i),
+				    _mm256_add_epi64(xv, yv));
+	}
+	return i;
+}
+AC_BATCH_AVX2 size_t u_add_32c1_v256(const uint32c1_t *x, const uint32c1_t *y,
+				     uint32c1_t *r, size_t n)
+{
+	return add_32c1_v256((const int32c1_t *)x, (const int32c1_t *)y,
+			     (int32c1_t *)r, n);
+}
+
+// valc is a multiple of A iff q=valc*A^-1 mod 2^64 is in the range of valc/A, then q is the quotient.
+// The check compares val with the quotient truncated to 32 bits, as decode_32c1.
+AC_BATCH_AVX2 size_t check_32c1_v256(const int32c1_t *val,
+				     const int32c1_t *valc, size_t n, int *ok)
+{
+	const __m256i inv = _mm256_set1_epi64x((int64_t)AC_AN32_INV(A1_32));
+	const __m256i bound = _mm256_set1_epi64x(AC_AN32_BOUND(A1_32));
+	const __m256i bound2 = _mm256_set1_epi64x(2 * AC_AN32_BOUND(A1_32));
+	__m256i valid = _mm256_set1_epi64x(-1);
+	size_t i = 0;
+	for (; i + 4 <= n; i += 4) {
+		__m256i v = _mm256_loadu_si256((const __m256i *)(val + i));
+		__m256i c = _mm256_loadu_si256((const __m256i *)(valc + i));
+		__m256i q = ac_v256_mullo64(c, inv);
+		__m256i div = ac_v256_ule64(_mm256_add_epi64(q, bound), bound2);
+		// sign extension of the low 32 bits of q
+		__m256i d = _mm256_blend_epi32(
+			q, _mm256_srai_epi32(_mm256_slli_epi64(q, 32), 31),
+			0xaa);
+		valid = _mm256_and_si256(
+			valid,
+			_mm256_and_si256(div, _mm256_cmpeq_epi64(v, d)));
+	}
+	*ok = _mm256_movemask_epi8(valid) == -1;
+	return i;
+}
+AC_BATCH_AVX2 size_t u_check_32c1_v256(const uint32c1_t *val,
+				       const uint32c1_t *valc, size_t n,
+				       int *ok)
+{
+	const __m256i inv = _mm256_set1_epi64x((int64_t)AC_AN32_INV(A1_32));
+	const __m256i bound = _mm256_set1_epi64x(AC_AN32_BOUND_U(A1_32));
+	const __m256i lo32 = _mm256_set1_epi64x(0xffffffff);
+	__m256i valid = _mm256_set1_epi64x(-1);
+	size_t i = 0;
+	for (; i + 4 <= n; i += 4) {
+		__m256i v = _mm256_loadu_si256((const __m256i *)(val + i));
+		__m256i c = _mm256_loadu_si256((const __m256i *)(valc + i));
+		__m256i q = ac_v256_mullo64(c, inv);
+		__m256i div = ac_v256_ule64(q, bound);
+		__m256i d = _mm256_and_si256(q, lo32);
+		valid = _mm256_and_si256(
+			valid,
+			_mm256_and_si256(div, _mm256_cmpeq_epi64(v, d)));
+	}
+	*ok = _mm256_movemask_epi8(valid) == -1;
+	return i;
+}
+#endif
+
+AC_BATCH_DEFINE_OPS_VEC(32c1, int32c1_t, uint32c1_t, int32_t, uint32_t)
+AC_BATCH_DEFINE_CHECK_VEC(32c1, int32c1_t, uint32c1_t, int32c1_t, uint32c1_t)
+AC_CKPT_DEFINE_MOD(32c1, uint32c1_t, A1_32)
+AC_CKPT_DEFINE_AN(32c1, int32c1_t, uint32c1_t, A1_32, ckpt_mod_32c1)
+
 #endif //AN32_C1_H_
\ No newline at end of file
@@ -20,6 +20,9 @@
 #include <stdint.h>
 #include <stdlib.h>
 #include "common.h"
+#include "batch.h"
+#include "checkpoint.h"
+#include "an_param.h"
 #define ENCODING_NAME "AN_64BIT"
 
 // A for encoding AN in 64bits
@@ -29,12 +32,13 @@
 
 typedef __uint128_t uint64c1_t;
 typedef __int128_t int64c1_t;
-__uint128_t sub = 0xffffffffffff1addUL;
-__uint128_t pow64 = 1UL;
-__uint128_t pow64A = 1UL;
+// Each translation unit has its own constants and has to call init(), calling it again keeps the constants
+static __uint128_t sub = 0xffffffffffff1addUL;
+static __uint128_t pow64 = 1UL;
+static __uint128_t pow64A = 1UL;
 static inline void init()
 {
-	pow64 = pow64 << 64;
+	pow64 = (__uint128_t)1 << 64;
 	pow64A = pow64 * A1_64;
 	__uint128_t interim = pow64 - A1_64;
 	sub = pow64 * interim;
@@ -159,103 +163,75 @@ AC_INLINE uint64c1_t u_mod_64c1(uint64c1_t x_c1, uint64c1_t y_c1)
 
 AC_INLINE int64c1_t eq_64c1(int64c1_t x_c1, int64c1_t y_c1)
 {
-	int64c1_t r_c1 = 0;
-	if (x_c1 == y_c1) {
-		r_c1 = A1_64;
-	}
+	int64c1_t r_c1 = A1_64 & AC_MASK(int64c1_t, x_c1 == y_c1);
 	return r_c1;
 }
 AC_INLINE uint64c1_t u_eq_64c1(uint64c1_t x_c1, uint64c1_t y_c1)
 {
-	uint64c1_t r_c1 = 0;
-	if (x_c1 == y_c1) {
-		r_c1 = A1_64;
-	}
+	uint64c1_t r_c1 = A1_64 & AC_MASK(uint64c1_t, x_c1 == y_c1);
 	return r_c1;
 }
 
 AC_INLINE int64c1_t neq_64c1(int64c1_t x_c1, int64c1_t y_c1)
 {
-	int64c1_t r_c1 = 0;
-	if (x_c1 != y_c1) {
-		r_c1 = A1_64;
-	}
+	int64c1_t r_c1 = A1_64 & AC_MASK(int64c1_t, x_c1 != y_c1);
 	return r_c1;
 }
 AC_INLINE uint64c1_t u_neq_64c1(uint64c1_t x_c1, uint64c1_t y_c1)
 {
-	uint64c1_t r_c1 = 0;
-	if (x_c1 != y_c1) {
-		r_c1 = A1_64;
-	}
+	uint64c1_t r_c1 = A1_64 & AC_MASK(uint64c1_t, x_c1 != y_c1);
 	return r_c1;
 }
 
 AC_INLINE int64c1_t less_64c1(int64c1_t x_c1, int64c1_t y_c1)
 {
-	int64c1_t r_c1 = 0;
-	if (x_c1 < y_c1) {
-		r_c1 = A1_64;
-	}
+	int c = ac_an_slt128(x_c1, y_c1);
+	int64c1_t r_c1 = A1_64 & AC_MASK(int64c1_t, c);
 	return r_c1;
 }
 AC_INLINE uint64c1_t u_less_64c1(uint64c1_t x_c1, uint64c1_t y_c1)
 {
-	uint64c1_t r_c1 = 0;
-	if (x_c1 < y_c1) {
-		r_c1 = A1_64;
-	}
+	int c = ac_an_ult128(x_c1, y_c1);
+	uint64c1_t r_c1 = A1_64 & AC_MASK(uint64c1_t, c);
 	return r_c1;
 }
 
 AC_INLINE int64c1_t grt_64c1(int64c1_t x_c1, int64c1_t y_c1)
 {
-	int64c1_t r_c1 = 0;
-	if (x_c1 > y_c1) {
-		r_c1 = A1_64;
-	}
+	int c = ac_an_slt128(y_c1, x_c1);
+	int64c1_t r_c1 = A1_64 & AC_MASK(int64c1_t, c);
 	return r_c1;
 }
 AC_INLINE uint64c1_t u_grt_64c1(uint64c1_t x_c1, uint64c1_t y_c1)
 {
-	uint64c1_t r_c1 = 0;
-	if (x_c1 > y_c1) {
-		r_c1 = A1_64;
-	}
+	int c = ac_an_ult128(y_c1, x_c1);
+	uint64c1_t r_c1 = A1_64 & AC_MASK(uint64c1_t, c);
 	return r_c1;
 }
 
 AC_INLINE int64c1_t leq_64c1(int64c1_t x_c1, int64c1_t y_c1)
 {
-	int64c1_t r_c1 = 0;
-	if (x_c1 <= y_c1) {
-		r_c1 = A1_64;
-	}
+	int c = !ac_an_slt128(y_c1, x_c1);
+	int64c1_t r_c1 = A1_64 & AC_MASK(int64c1_t, c);
 	return r_c1;
 }
 AC_INLINE uint64c1_t u_leq_64c1(uint64c1_t x_c1, uint64c1_t y_c1)
 {
-	uint64c1_t r_c1 = 0;
-	if (x_c1 <= y_c1) {
-		r_c1 = A1_64;
-	}
+	int c = !ac_an_ult128(y_c1, x_c1);
+	uint64c1_t r_c1 = A1_64 & AC_MASK(uint64c1_t, c);
 	return r_c1;
 }
 
 AC_INLINE int64c1_t geq_64c1(int64c1_t x_c1, int64c1_t y_c1)
 {
-	int64c1_t r_c1 = 0;
-	if (x_c1 >= y_c1) {
-		r_c1 = A1_64;
-	}
+	int c = !ac_an_slt128(x_c1, y_c1);
+	int64c1_t r_c1 = A1_64 & AC_MASK(int64c1_t, c);
 	return r_c1;
 }
 AC_INLINE uint64c1_t u_geq_64c1(uint64c1_t x_c1, uint64c1_t y_c1)
 {
-	uint64c1_t r_c1 = 0;
-	if (x_c1 >= y_c1) {
-		r_c1 = A1_64;
-	}
+	int c = !ac_an_ult128(x_c1, y_c1);
+	uint64c1_t r_c1 = A1_64 & AC_MASK(uint64c1_t, c);
 	return r_c1;
 }
 
@@ -289,17 +265,13 @@ AC_INLINE uint64c1_t u_shr_64c1(uint64c1_t x_c1, uint64c1_t y_c1)
 AC_INLINE int64c1_t land_64c1(int64c1_t x_c1, int64c1_t y_c1)
 {
 	int64c1_t r_c1 = mul_64c1(x_c1, y_c1);
-	if (r_c1 != 0) {
-		r_c1 = A1_64;
-	}
+	r_c1 = A1_64 & AC_MASK(int64c1_t, r_c1 != 0);
 	return r_c1;
 }
 AC_INLINE uint64c1_t u_land_64c1(uint64c1_t x_c1, uint64c1_t y_c1)
 {
 	uint64c1_t r_c1 = u_mul_64c1(x_c1, y_c1);
-	if (r_c1 != 0) {
-		r_c1 = A1_64;
-	}
+	r_c1 = A1_64 & AC_MASK(uint64c1_t, r_c1 != 0);
 	return r_c1;
 }
 /*	OR Table
@@ -311,30 +283,14 @@ AC_INLINE uint64c1_t u_land_64c1(uint64c1_t x_c1, uint64c1_t y_c1)
  */
 AC_INLINE int64c1_t lor_64c1(int64c1_t x_c1, int64c1_t y_c1)
 {
-	int64c1_t r_c1 = x_c1 + y_c1;
-	if (r_c1 != 0) {
-		r_c1 = A1_64;
-	}
-	//Force true if one value is negative. For x=-n and y=n the addition is 0 but the result is true
-	if (x_c1 < 0) {
-		r_c1 = A1_64;
-	}
-	if (y_c1 < 0) {
-		r_c1 = A1_64;
-	}
+	//x + y can wrap to 0 although the result is true, so the operands are tested directly
+	int64c1_t r_c1 = A1_64 & AC_MASK(int64c1_t, (x_c1 | y_c1) != 0);
 	return r_c1;
 }
 AC_INLINE uint64c1_t u_lor_64c1(uint64c1_t x_c1, uint64c1_t y_c1)
 {
-	uint64c1_t r_c1 = x_c1 + y_c1;
-	if (r_c1 != 0) {
-		r_c1 = A1_64;
-	} else {
-		//Force true if overlow is detected. AS the overlow can lead to a 0 which would be intepreted as False
-		if (r_c1 < x_c1 && r_c1 < y_c1) {
-			r_c1 = A1_64;
-		}
-	}
+	//x + y can wrap to 0 although the result is true, so the operands are tested directly
+	uint64c1_t r_c1 = A1_64 & AC_MASK(uint64c1_t, (x_c1 | y_c1) != 0);
 	return r_c1;
 }
 
@@ -404,4 +360,115 @@ AC_INLINE uint64c1_t u_xor_64c1(uint64c1_t x_c1, uint64c1_t y_c1)
 	return r_c1;
 }
 
+#ifdef AC_BATCH_HAS_AVX2
+// AVX2 kernels of the batch operations, 2 code words per vector with the low half first
+AC_BATCH_AVX2 size_t add_64c1_v256(const int64c1_t *x, const int64c1_t *y,
+				   int64c1_t *r, size_t n)
+{
+	size_t i = 0;
+	for (; i + 2 <= n; i += 2) {
+		__m256i xv = _mm256_loadu_si256((const __m256i *)(x + i));
+		__m256i yv = _mm256_loadu_si256((const __m256i *)(y + i));
+		__m256i sum = _mm256_add_epi64(xv, yv);
+		// carry of the low halves into the high halves, the mask is -1 for a carry
+		__m256i carry = _mm256_bslli_epi128(ac_v256_ult64(sum, xv), 8);
+		_mm256_storeu_si256((__m256i *)(r + i),
+				    _mm256_sub_epi64(sum, carry));
+	}
+	return i;
+}
+AC_BATCH_AVX2 size_t u_add_64c1_v256(const uint64c1_t *x, const uint64c1_t *y,
+				     uint64c1_t *r, size_t n)
+{
+	return add_64c1_v256((const int64c1_t *)x, (const int64c1_t *)y,
+			     (int64c1_t *)r, n);
+}
+
+// x <= y for 128 bit values split in low and high halves
+AC_BATCH_AVX2_INLINE __m256i ac_v256_ule128_64c1(__m256i xl, __m256i xh,
+						  __m256i yl, __m256i yh)
+{
+	return _mm256_or_si256(ac_v256_ult64(xh, yh),
+			       _mm256_and_si256(_mm256_cmpeq_epi64(xh, yh),
+						ac_v256_ule64(xl, yl)));
+}
+// q=valc*A^-1 mod 2^128 for 4 code words, split in low and high halves
+AC_BATCH_AVX2_INLINE __m256i ac_v256_quo_64c1(const void *valc, __m256i *qh)
+{
+	const __m256i invl = _mm256_set1_epi64x((int64_t)AC_AN64_INV(A1_64));
+	const __m256i invh =
+		_mm256_set1_epi64x((int64_t)(AC_AN64_INV(A1_64) >> 64));
+	__m256i c0 = _mm256_loadu_si256((const __m256i *)valc);
+	__m256i c1 = _mm256_loadu_si256((const __m256i *)valc + 1);
+	__m256i cl = _mm256_unpacklo_epi64(c0, c1);
+	__m256i ch = _mm256_unpackhi_epi64(c0, c1);
+	__m256i ph, ql = ac_v256_mul64(cl, invl, &ph);
+	*qh = _mm256_add_epi64(ph, _mm256_add_epi64(ac_v256_mullo64(cl, invh),
+						    ac_v256_mullo64(ch, invl)));
+	return ql;
+}
+
+// valc is a multiple of A iff q=valc*A^-1 mod 2^128 is in the range of valc/A, then q is the quotient.
+// The check compares val with the quotient truncated to 64 bits, as decode_64c1.
+AC_BATCH_AVX2 size_t check_64c1_v256(const int64c1_t *val,
+				     const int64c1_t *valc, size_t n, int *ok)
+{
+	const __uint128_t b = AC_AN64_BOUND(A1_64);
+	const __m256i bl = _mm256_set1_epi64x((int64_t)b);
+	const __m256i bh = _mm256_set1_epi64x((int64_t)(b >> 64));
+	const __m256i b2l = _mm256_set1_epi64x((int64_t)(2 * b));
+	const __m256i b2h = _mm256_set1_epi64x((int64_t)((2 * b) >> 64));
+	__m256i valid = _mm256_set1_epi64x(-1);
+	size_t i = 0;
+	for (; i + 4 <= n; i += 4) {
+		__m256i qh, ql = ac_v256_quo_64c1(valc + i, &qh);
+		__m256i v0 = _mm256_loadu_si256((const __m256i *)(val + i));
+		__m256i v1 = _mm256_loadu_si256((const __m256i *)(val + i) + 1);
+		__m256i vl = _mm256_unpacklo_epi64(v0, v1);
+		__m256i vh = _mm256_unpackhi_epi64(v0, v1);
+		__m256i tl = _mm256_add_epi64(ql, bl);
+		__m256i th = _mm256_sub_epi64(_mm256_add_epi64(qh, bh),
+					      ac_v256_ult64(tl, ql));
+		__m256i div = ac_v256_ule128_64c1(tl, th, b2l, b2h);
+		__m256i eq = _mm256_and_si256(
+			_mm256_cmpeq_epi64(vl, ql),
+			_mm256_cmpeq_epi64(
+				vh, _mm256_cmpgt_epi64(_mm256_setzero_si256(),
+						       ql)));
+		valid = _mm256_and_si256(valid, _mm256_and_si256(div, eq));
+	}
+	*ok = _mm256_movemask_epi8(valid) == -1;
+	return i;
+}
+AC_BATCH_AVX2 size_t u_check_64c1_v256(const uint64c1_t *val,
+				       const uint64c1_t *valc, size_t n,
+				       int *ok)
+{
+	const __uint128_t b = AC_AN64_BOUND_U(A1_64);
+	const __m256i bl = _mm256_set1_epi64x((int64_t)b);
+	const __m256i bh = _mm256_set1_epi64x((int64_t)(b >> 64));
+	__m256i valid = _mm256_set1_epi64x(-1);
+	size_t i = 0;
+	for (; i + 4 <= n; i += 4) {
+		__m256i qh, ql = ac_v256_quo_64c1(valc + i, &qh);
+		__m256i v0 = _mm256_loadu_si256((const __m256i *)(val + i));
+		__m256i v1 = _mm256_loadu_si256((const __m256i *)(val + i) + 1);
+		__m256i vl = _mm256_unpacklo_epi64(v0, v1);
+		__m256i vh = _mm256_unpackhi_epi64(v0, v1);
+		__m256i div = ac_v256_ule128_64c1(ql, qh, bl, bh);
+		__m256i eq = _mm256_and_si256(
+			_mm256_cmpeq_epi64(vl, ql),
+			_mm256_cmpeq_epi64(vh, _mm256_setzero_si256()));
+		valid = _mm256_and_si256(valid, _mm256_and_si256(div, eq));
+	}
+	*ok = _mm256_movemask_epi8(valid) == -1;
+	return i;
+}
+#endif
+
+AC_BATCH_DEFINE_OPS_VEC(64c1, int64c1_t, uint64c1_t, int64_t, uint64_t)
+AC_BATCH_DEFINE_CHECK_VEC(64c1, int64c1_t, uint64c1_t, int64c1_t, uint64c1_t)
+AC_CKPT_DEFINE_MOD(64c1, uint64c1_t, A1_64)
+AC_CKPT_DEFINE_AN(64c1, int64c1_t, uint64c1_t, A1_64, ckpt_mod_64c1)
+
 #endif //AN32_C1_H_
\ No newline at end of file
@@ -0,0 +1,33 @@
+/**
+ * @copyright: (c) 2022, Institute for Control Engineering of Machine Tools and Manufacturing Units,
+ *             University of Stuttgart
+ *             All rights reserved. Licensed under the Apache License, Version 2.0 (the "License");
+ *             you may not use this file except in compliance with the License.
+ *             You may obtain a copy of the License at
+ *                  http://www.apache.org/licenses/LICENSE-2.0
+ *             Unless required by applicable law or agreed to in writing, software
+ *             distributed under the License is distributed on an "AS IS" BASIS,
+ *             WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *             See the License for the specific language governing permissions and
+ *             limitations under the License.
+ * @author: Marc Fischer <marc.fischer@isw.uni-stuttgart.de>
+ * @description: Provides all primitive functions for AN-Encoding of one channel without hardware division by A.
+ *               Decoding uses a magic multiplier and the code check multiplies with the modular inverse of A.
+ *               Only the encoded div/mod still divide by the (variable) divisor. The functions are generated by
+ *               an_param_32.h, which derives all constants from A.
+ */
+
+#ifndef ANDF32_H_
+#define ANDF32_H_
+
+#define ENCODING_NAME "AN_DIVFREE_32BIT"
+
+// A for encoding AN in 32bits
+// 58659, 59665, 63157, 63859, 63877 are the best As [Ulbrich,2014,Ganzheutliche Fehlertoleranz in eingebetteten Softwaresystemen]
+#define A1_32 58659
+
+#define AN_PARAM_A A1_32
+#define AN_PARAM_SFX 32c1
+#include "an_param_32.h"
+
+#endif //ANDF32_H_
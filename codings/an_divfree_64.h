@@ -0,0 +1,34 @@
+/**
+ * @copyright: (c) 2022, Institute for Control Engineering of Machine Tools and Manufacturing Units,
+ *             University of Stuttgart
+ *             All rights reserved. Licensed under the Apache License, Version 2.0 (the "License");
+ *             you may not use this file except in compliance with the License.
+ *             You may obtain a copy of the License at
+ *                  http://www.apache.org/licenses/LICENSE-2.0
+ *             Unless required by applicable law or agreed to in writing, software
+ *             distributed under the License is distributed on an "AS IS" BASIS,
+ *             WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *             See the License for the specific language governing permissions and
+ *             limitations under the License.
+ * @author: Marc Fischer <marc.fischer@isw.uni-stuttgart.de>
+ * @description: Provides all primitive functions for AN-Encoding of one channel without division by A.
+ *               Decoding uses a magic multiplier and the code check multiplies with the modular inverse of A,
+ *               so no 128 bit library division (__divti3/__udivti3) is called. The functions are generated by
+ *               an_param_64.h, which derives all constants from A.
+ */
+
+#ifndef ANDF64_H_
+#define ANDF64_H_
+
+#define ENCODING_NAME "AN_DIVFREE_64BIT"
+
+// A for encoding AN in 64bits
+// 58659, 59665, 63157, 63859, 63877 are the best As for 32bit [Ulbrich,2014,Ganzheutliche Fehlertoleranz in eingebetteten Softwaresystemen]
+// We use this just for validation and performance. This A does not have the best detection capabilities
+#define A1_64 58659
+
+#define AN_PARAM_A A1_64
+#define AN_PARAM_SFX 64c1
+#include "an_param_64.h"
+
+#endif //ANDF64_H_
@@ -0,0 +1,537 @@
+/**
+ * @copyright: (c) 2022, Institute for Control Engineering of Machine Tools and Manufacturing Units,
+ *             University of Stuttgart
+ *             All rights reserved. Licensed under the Apache License, Version 2.0 (the "License");
+ *             you may not use this file except in compliance with the License.
+ *             You may obtain a copy of the License at
+ *                  http://www.apache.org/licenses/LICENSE-2.0
+ *             Unless required by applicable law or agreed to in writing, software
+ *             distributed under the License is distributed on an "AS IS" BASIS,
+ *             WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *             See the License for the specific language governing permissions and
+ *             limitations under the License.
+ * @author: Marc Fischer <marc.fischer@isw.uni-stuttgart.de>
+ * @description: Provides all primitive functions for AN-Encoding of one channel with two 64 bit limbs.
+ *               The 128 bit code words are stored as lo/hi limbs and all products are built from 64x64->128 bit
+ *               multiplications (mulx/_umul128). All correction constants are compile time constants, so no init()
+ *               and no global state is needed and the header can be included in several translation units.
+ *               Decoding and check are division-free (magic multiplier and modular inverse of A).
+ */
+
+#ifndef ANLIMB64_H_
+#define ANLIMB64_H_
+
+#include <stdint.h>
+#include <stdlib.h>
+#include "common.h"
+#include "batch.h"
+#include "an_param.h"
+#if defined(__BMI2__) && defined(__x86_64__)
+#include <immintrin.h>
+#elif defined(_MSC_VER) && defined(_M_X64)
+#include <intrin.h>
+#endif
+#define ENCODING_NAME "AN_LIMB_64BIT"
+
+// A for encoding AN in 64bits
+// 58659, 59665, 63157, 63859, 63877 are the best As for 32bit [Ulbrich,2014,Ganzheutliche Fehlertoleranz in eingebetteten Softwaresystemen]
+// We use this just for validation and performance. This A does not have the best detection capabilities
+#define A1_64 58659
+
+// Code word in two's complement. The signed and unsigned operations share the representation.
+typedef struct {
+	uint64_t lo;
+	uint64_t hi;
+} uint64c1_t;
+typedef uint64c1_t int64c1_t;
+
+// Constants depending on A. They are literals, as this coding does not need a 128 bit type (MSVC). Compilers with
+// a 128 bit type check them against the derivation from A1_64 in an_param.h, so a changed A fails to compile.
+// Magic number for the division by A: floor(2^(128+AC_AN_SHIFT64)/A)+1 with AC_AN_SHIFT64=floor(log2(A))
+#define AC_AN_MAGIC64_LO 0x8ef0dc4e1e8a6c86UL
+#define AC_AN_MAGIC64_HI 0x8f019e7eb1633625UL
+#define AC_AN_SHIFT64 15
+// A^-1 mod 2^128
+#define AC_AN_INV64_LO 0x303087aca93e728bUL
+#define AC_AN_INV64_HI 0x72c3faa40877708aUL
+// floor((2^127-1)/A) and floor((2^128-1)/A). x*A^-1 mod 2^128 is in this range iff x is a multiple of A
+#define AC_AN_BOUND64_LO 0x36258ef0dc4e1e8aUL
+#define AC_AN_BOUND64_HI 0x8f019e7eb163UL
+#define AC_AN_BOUND64_U_LO 0x6c4b1de1b89c3d14UL
+#define AC_AN_BOUND64_U_HI 0x11e033cfd62c6UL
+
+#ifdef __SIZEOF_INT128__
+#define AC_AN_LIMB64_EQ(c, lo, hi)                                             \
+	((uint64_t)(c) == (lo) && (uint64_t)((c) >> 64) == (hi))
+AC_AN_STATIC_ASSERT(AC_AN_SHIFT64 == AC_AN64_SHIFT(A1_64),
+		    "AC_AN_SHIFT64 does not match A1_64");
+AC_AN_STATIC_ASSERT(AC_AN_LIMB64_EQ(AC_AN64_MAGIC(A1_64), AC_AN_MAGIC64_LO,
+				    AC_AN_MAGIC64_HI),
+		    "AC_AN_MAGIC64 does not match A1_64");
+AC_AN_STATIC_ASSERT(AC_AN_LIMB64_EQ(AC_AN64_INV(A1_64), AC_AN_INV64_LO,
+				    AC_AN_INV64_HI),
+		    "AC_AN_INV64 does not match A1_64");
+AC_AN_STATIC_ASSERT(AC_AN_LIMB64_EQ(AC_AN64_BOUND(A1_64), AC_AN_BOUND64_LO,
+				    AC_AN_BOUND64_HI),
+		    "AC_AN_BOUND64 does not match A1_64");
+AC_AN_STATIC_ASSERT(AC_AN_LIMB64_EQ(AC_AN64_BOUND_U(A1_64),
+				    AC_AN_BOUND64_U_LO, AC_AN_BOUND64_U_HI),
+		    "AC_AN_BOUND64_U does not match A1_64");
+#endif
+
+// Returns the low 64 bits of a*b and stores the high 64 bits in hi
+AC_INLINE uint64_t umul_64c1(uint64_t a, uint64_t b, uint64_t *hi)
+{
+#if defined(__BMI2__) && defined(__x86_64__)
+	unsigned long long h;
+	uint64_t lo = _mulx_u64(a, b, &h);
+	*hi = h;
+	return lo;
+#elif defined(_MSC_VER) && defined(_M_X64)
+	return _umul128(a, b, hi);
+#else
+	__uint128_t p = (__uint128_t)a * b;
+	*hi = (uint64_t)(p >> 64);
+	return (uint64_t)p;
+#endif
+}
+
+AC_INLINE uint64c1_t limb_64c1(uint64_t lo, uint64_t hi)
+{
+	uint64c1_t r = { lo, hi };
+	return r;
+}
+AC_INLINE uint64c1_t limb_add_64c1(uint64c1_t x, uint64c1_t y)
+{
+	uint64c1_t r;
+	r.lo = x.lo + y.lo;
+	r.hi = x.hi + y.hi + (r.lo < x.lo);
+	return r;
+}
+AC_INLINE uint64c1_t limb_sub_64c1(uint64c1_t x, uint64c1_t y)
+{
+	uint64c1_t r;
+	r.lo = x.lo - y.lo;
+	r.hi = x.hi - y.hi - (x.lo < y.lo);
+	return r;
+}
+// Conditional two's complement negation. mask is 0 or 0xFFFFFFFFFFFFFFFF
+AC_INLINE uint64c1_t limb_cneg_64c1(uint64c1_t x, uint64_t mask)
+{
+	return limb_sub_64c1(limb_64c1(x.lo ^ mask, x.hi ^ mask),
+			     limb_64c1(mask, mask));
+}
+// Low 128 bits of x*y
+AC_INLINE uint64c1_t limb_mul_64c1(uint64c1_t x, uint64c1_t y)
+{
+	uint64c1_t r;
+	r.lo = umul_64c1(x.lo, y.lo, &r.hi);
+	r.hi += x.lo * y.hi + x.hi * y.lo;
+	return r;
+}
+// High 128 bits of the 256 bit product x*y
+AC_INLINE uint64c1_t limb_mulhi_64c1(uint64c1_t x, uint64c1_t y)
+{
+	uint64_t h00, h01, h10, h11;
+	uint64_t l00 = umul_64c1(x.lo, y.lo, &h00);
+	uint64_t l01 = umul_64c1(x.lo, y.hi, &h01);
+	uint64_t l10 = umul_64c1(x.hi, y.lo, &h10);
+	uint64_t l11 = umul_64c1(x.hi, y.hi, &h11);
+	(void)l00;
+	//middle column: h00 + l01 + l10, the carries go to the high limbs
+	uint64_t mid = h00 + l01;
+	uint64_t carry = mid < l01;
+	mid += l10;
+	carry += mid < l10;
+	uint64c1_t r = limb_add_64c1(limb_64c1(l11, h11), limb_64c1(h01, 0));
+	return limb_add_64c1(r, limb_64c1(h10 + carry, h10 + carry < h10));
+}
+AC_INLINE int limb_ult_64c1(uint64c1_t x, uint64c1_t y)
+{
+	return (x.hi < y.hi) | ((x.hi == y.hi) & (x.lo < y.lo));
+}
+AC_INLINE int limb_slt_64c1(int64c1_t x, int64c1_t y)
+{
+	return ((int64_t)x.hi < (int64_t)y.hi) |
+	       ((x.hi == y.hi) & (x.lo < y.lo));
+}
+AC_INLINE int limb_eq_64c1(uint64c1_t x, uint64c1_t y)
+{
+	return (x.lo == y.lo) & (x.hi == y.hi);
+}
+AC_INLINE int limb_iszero_64c1(uint64c1_t x)
+{
+	return (x.lo | x.hi) == 0;
+}
+// x << n, n < 128
+AC_INLINE uint64c1_t limb_shl_64c1(uint64c1_t x, unsigned n)
+{
+	if (n >= 64) {
+		return limb_64c1(0, x.lo << (n - 64));
+	}
+	if (n == 0) {
+		return x;
+	}
+	return limb_64c1(x.lo << n, (x.hi << n) | (x.lo >> (64 - n)));
+}
+// x >> n (logical), n < 128
+AC_INLINE uint64c1_t limb_shr_64c1(uint64c1_t x, unsigned n)
+{
+	if (n >= 64) {
+		return limb_64c1(x.hi >> (n - 64), 0);
+	}
+	if (n == 0) {
+		return x;
+	}
+	return limb_64c1((x.lo >> n) | (x.hi << (64 - n)), x.hi >> n);
+}
+// Encoded constant: (0 or 1)*A
+AC_INLINE uint64c1_t limb_bool_64c1(int b)
+{
+	return limb_64c1(A1_64 & AC_MASK(uint64_t, b != 0), 0);
+}
+
+// floor(x/A) for x <= 2^127, which covers all code words
+AC_INLINE uint64c1_t u_magicdiv_64c1(uint64c1_t x)
+{
+	uint64c1_t q = limb_mulhi_64c1(
+		x, limb_64c1(AC_AN_MAGIC64_LO, AC_AN_MAGIC64_HI));
+	return limb_shr_64c1(q, AC_AN_SHIFT64);
+}
+// x/A rounded towards zero, identical to the C division
+AC_INLINE int64c1_t magicdiv_64c1(int64c1_t x)
+{
+	uint64_t sign = (uint64_t)((int64_t)x.hi >> 63);
+	uint64c1_t q = u_magicdiv_64c1(limb_cneg_64c1(x, sign));
+	return limb_cneg_64c1(q, sign);
+}
+
+// x % A == 0
+AC_INLINE int divisible_64c1(int64c1_t x)
+{
+	uint64c1_t bound = limb_64c1(AC_AN_BOUND64_LO, AC_AN_BOUND64_HI);
+	uint64c1_t t = limb_add_64c1(
+		limb_mul_64c1(x, limb_64c1(AC_AN_INV64_LO, AC_AN_INV64_HI)),
+		bound);
+	return !limb_ult_64c1(limb_add_64c1(bound, bound), t);
+}
+AC_INLINE int u_divisible_64c1(uint64c1_t x)
+{
+	uint64c1_t t =
+		limb_mul_64c1(x, limb_64c1(AC_AN_INV64_LO, AC_AN_INV64_HI));
+	return !limb_ult_64c1(
+		limb_64c1(AC_AN_BOUND64_U_LO, AC_AN_BOUND64_U_HI), t);
+}
+
+AC_INLINE int64c1_t encode_64c1(int64_t x)
+{
+	//sign extension of x: the high limb of the unsigned product is corrected by -A
+	int64c1_t r_c1;
+	r_c1.lo = umul_64c1((uint64_t)x, A1_64, &r_c1.hi);
+	r_c1.hi -= (uint64_t)(x >> 63) & A1_64;
+	return r_c1;
+}
+AC_INLINE uint64c1_t u_encode_64c1(uint64_t x)
+{
+	uint64c1_t r_c1;
+	r_c1.lo = umul_64c1(x, A1_64, &r_c1.hi);
+	return r_c1;
+}
+
+AC_INLINE int64_t decode_64c1(int64c1_t x_c1)
+{
+	int64_t r = (int64_t)magicdiv_64c1(x_c1).lo;
+	return r;
+}
+AC_INLINE uint64_t u_decode_64c1(uint64c1_t x_c1)
+{
+	uint64_t r = u_magicdiv_64c1(x_c1).lo;
+	return r;
+}
+
+AC_INLINE int check_64c1(int64_t val, int64c1_t valc)
+{
+	return (val == decode_64c1(valc)) && divisible_64c1(valc);
+}
+AC_INLINE int u_check_64c1(uint64_t val, uint64c1_t valc)
+{
+	return val == u_decode_64c1(valc) && u_divisible_64c1(valc);
+}
+
+AC_INLINE int64c1_t add_64c1(int64c1_t x_c1, int64c1_t y_c1)
+{
+	return limb_add_64c1(x_c1, y_c1);
+}
+AC_INLINE uint64c1_t u_add_64c1(uint64c1_t x_c1, uint64c1_t y_c1)
+{
+	return limb_add_64c1(x_c1, y_c1);
+}
+
+AC_INLINE int64c1_t sub_64c1(int64c1_t x_c1, int64c1_t y_c1)
+{
+	return limb_sub_64c1(x_c1, y_c1);
+}
+AC_INLINE uint64c1_t u_sub_64c1(uint64c1_t x_c1, uint64c1_t y_c1)
+{
+	uint64c1_t r_c1 = limb_sub_64c1(x_c1, y_c1);
+	if (limb_ult_64c1(x_c1, y_c1)) {
+		//-2^64(2^64-A) = 2^64*A mod 2^128, only the high limb is corrected
+		r_c1.hi += A1_64;
+	}
+	return r_c1;
+}
+
+AC_INLINE int64c1_t mul_64c1(int64c1_t x_c1, int64c1_t y_c1)
+{
+	int64c1_t x_d1 = magicdiv_64c1(x_c1);
+	int64c1_t y_d1 = magicdiv_64c1(y_c1);
+	int64_t res = (int64_t)(x_d1.lo * y_d1.lo);
+
+	int64c1_t r = limb_mul_64c1(x_d1, y_d1);
+	//quo = r/2^64 rounded towards zero. Only the low limb of quo contributes to quo*2^64*A
+	uint64_t quo = r.hi + (((int64_t)r.hi < 0) & (r.lo != 0));
+	int64c1_t r_c1 = limb_mul_64c1(x_c1, y_d1);
+	r_c1.hi -= quo * A1_64;
+
+	int r_neg = (int64_t)r.hi < 0;
+	int r_zero = limb_iszero_64c1(r);
+	if (!r_neg && !r_zero) {
+		if (res < 0) {
+			r_c1.hi -= A1_64; //+2^64(2^64-A)
+		}
+	} else {
+		if (res > 0) {
+			r_c1.hi += A1_64; //-2^64(2^64-A)
+		}
+	}
+
+	return r_c1;
+}
+AC_INLINE uint64c1_t u_mul_64c1(uint64c1_t x_c1, uint64c1_t y_c1)
+{
+	uint64c1_t x_d1 = u_magicdiv_64c1(x_c1);
+	uint64c1_t y_d1 = u_magicdiv_64c1(y_c1);
+
+	uint64c1_t r = limb_mul_64c1(x_d1, y_d1);
+	uint64c1_t r_c1 = limb_mul_64c1(x_c1, y_d1);
+	r_c1.hi -= r.hi * A1_64; //quo*2^64*A with quo=r/2^64
+
+	return r_c1;
+}
+
+//(A*x)/(A*y) = x/y. The quotient is calculated with the decoded values by a 64 bit division.
+AC_INLINE int64c1_t quo_64c1(int64c1_t x_c1, int64c1_t y_c1)
+{
+	int64_t x_d1 = decode_64c1(x_c1);
+	int64_t y_d1 = decode_64c1(y_c1);
+	uint64_t x_sign = (uint64_t)(x_d1 >> 63);
+	uint64_t y_sign = (uint64_t)(y_d1 >> 63);
+	//Divide the absolute values, as INT64_MIN/-1 does not fit into 64 bit
+	uint64_t q = (((uint64_t)x_d1 ^ x_sign) - x_sign) /
+		     (((uint64_t)y_d1 ^ y_sign) - y_sign);
+	return limb_cneg_64c1(limb_64c1(q, 0), x_sign ^ y_sign);
+}
+
+AC_INLINE int64c1_t div_64c1(int64c1_t x_c1, int64c1_t y_c1)
+{
+	int64c1_t r_c1 = limb_mul_64c1(quo_64c1(x_c1, y_c1), limb_64c1(A1_64, 0));
+	return r_c1;
+}
+AC_INLINE uint64c1_t u_div_64c1(uint64c1_t x_c1, uint64c1_t y_c1)
+{
+	uint64_t q = u_decode_64c1(x_c1) / u_decode_64c1(y_c1);
+	return u_encode_64c1(q);
+}
+
+//A*x-(x/y)*A*y = A*(x%y). Using the encoded x keeps a faulty x detectable.
+AC_INLINE int64c1_t mod_64c1(int64c1_t x_c1, int64c1_t y_c1)
+{
+	return limb_sub_64c1(x_c1, limb_mul_64c1(quo_64c1(x_c1, y_c1), y_c1));
+}
+AC_INLINE uint64c1_t u_mod_64c1(uint64c1_t x_c1, uint64c1_t y_c1)
+{
+	uint64_t q = u_decode_64c1(x_c1) / u_decode_64c1(y_c1);
+	return limb_sub_64c1(x_c1, limb_mul_64c1(limb_64c1(q, 0), y_c1));
+}
+
+AC_INLINE int64c1_t eq_64c1(int64c1_t x_c1, int64c1_t y_c1)
+{
+	return limb_bool_64c1(limb_eq_64c1(x_c1, y_c1));
+}
+AC_INLINE uint64c1_t u_eq_64c1(uint64c1_t x_c1, uint64c1_t y_c1)
+{
+	return limb_bool_64c1(limb_eq_64c1(x_c1, y_c1));
+}
+
+AC_INLINE int64c1_t neq_64c1(int64c1_t x_c1, int64c1_t y_c1)
+{
+	return limb_bool_64c1(!limb_eq_64c1(x_c1, y_c1));
+}
+AC_INLINE uint64c1_t u_neq_64c1(uint64c1_t x_c1, uint64c1_t y_c1)
+{
+	return limb_bool_64c1(!limb_eq_64c1(x_c1, y_c1));
+}
+
+AC_INLINE int64c1_t less_64c1(int64c1_t x_c1, int64c1_t y_c1)
+{
+	return limb_bool_64c1(limb_slt_64c1(x_c1, y_c1));
+}
+AC_INLINE uint64c1_t u_less_64c1(uint64c1_t x_c1, uint64c1_t y_c1)
+{
+	return limb_bool_64c1(limb_ult_64c1(x_c1, y_c1));
+}
+
+AC_INLINE int64c1_t grt_64c1(int64c1_t x_c1, int64c1_t y_c1)
+{
+	return limb_bool_64c1(limb_slt_64c1(y_c1, x_c1));
+}
+AC_INLINE uint64c1_t u_grt_64c1(uint64c1_t x_c1, uint64c1_t y_c1)
+{
+	return limb_bool_64c1(limb_ult_64c1(y_c1, x_c1));
+}
+
+AC_INLINE int64c1_t leq_64c1(int64c1_t x_c1, int64c1_t y_c1)
+{
+	return limb_bool_64c1(!limb_slt_64c1(y_c1, x_c1));
+}
+AC_INLINE uint64c1_t u_leq_64c1(uint64c1_t x_c1, uint64c1_t y_c1)
+{
+	return limb_bool_64c1(!limb_ult_64c1(y_c1, x_c1));
+}
+
+AC_INLINE int64c1_t geq_64c1(int64c1_t x_c1, int64c1_t y_c1)
+{
+	return limb_bool_64c1(!limb_slt_64c1(x_c1, y_c1));
+}
+AC_INLINE uint64c1_t u_geq_64c1(uint64c1_t x_c1, uint64c1_t y_c1)
+{
+	return limb_bool_64c1(!limb_ult_64c1(x_c1, y_c1));
+}
+
+AC_INLINE int64c1_t shl_64c1(int64c1_t x_c1, int64c1_t y_c1)
+{
+	unsigned y = (unsigned)decode_64c1(y_c1) & 127;
+	int64c1_t r_c1 =
+		mul_64c1(x_c1, limb_shl_64c1(limb_64c1(A1_64, 0), y)); //2^y*A
+	return r_c1; // result already AN-encoded
+}
+AC_INLINE uint64c1_t u_shl_64c1(uint64c1_t x_c1, uint64c1_t y_c1)
+{
+	unsigned y = (unsigned)u_decode_64c1(y_c1) & 127;
+	uint64c1_t r_c1 =
+		u_mul_64c1(x_c1, limb_shl_64c1(limb_64c1(A1_64, 0), y));
+
+	return r_c1;
+}
+
+//INFO:	The behaviour of the signed right shift depends on the compiler implementation. Therfore this operation is not
+//		supported and is prohibited.
+
+AC_INLINE uint64c1_t u_shr_64c1(uint64c1_t x_c1, uint64c1_t y_c1)
+{
+	unsigned y = (unsigned)u_decode_64c1(y_c1) & 127;
+	//x/(2^y*A)*A = ((x/A) >> y)*A
+	uint64c1_t r_c1 = limb_mul_64c1(
+		limb_shr_64c1(u_magicdiv_64c1(x_c1), y), limb_64c1(A1_64, 0));
+
+	return r_c1;
+}
+
+AC_INLINE int64c1_t land_64c1(int64c1_t x_c1, int64c1_t y_c1)
+{
+	int64c1_t r_c1 = mul_64c1(x_c1, y_c1);
+	return limb_bool_64c1(!limb_iszero_64c1(r_c1));
+}
+AC_INLINE uint64c1_t u_land_64c1(uint64c1_t x_c1, uint64c1_t y_c1)
+{
+	uint64c1_t r_c1 = u_mul_64c1(x_c1, y_c1);
+	return limb_bool_64c1(!limb_iszero_64c1(r_c1));
+}
+/*	OR Table
+ * 	| x | Y | Result |
+ *	| 0 | 0 |   0    |
+ *	| 0 |!=0| ENC(1) |
+ *	|!=0| 0 | ENC(1) |
+ *	|!=0|!=0| ENC(1) |
+ */
+AC_INLINE int64c1_t lor_64c1(int64c1_t x_c1, int64c1_t y_c1)
+{
+	//x + y can wrap to 0 although the result is true, so the operands are tested directly
+	return limb_bool_64c1((x_c1.lo | x_c1.hi | y_c1.lo | y_c1.hi) != 0);
+}
+AC_INLINE uint64c1_t u_lor_64c1(uint64c1_t x_c1, uint64c1_t y_c1)
+{
+	//x + y can wrap to 0 although the result is true, so the operands are tested directly
+	return limb_bool_64c1((x_c1.lo | x_c1.hi | y_c1.lo | y_c1.hi) != 0);
+}
+
+AC_INLINE int64c1_t and_64c1(int64c1_t x_c1, int64c1_t y_c1)
+{
+	//Diversify logic operations
+	int64_t x_d1 = decode_64c1(x_c1);
+	int64_t y_d1 = decode_64c1(y_c1);
+	int64_t r_c = -1 - ((-1 - x_d1) | (-1 - y_d1));
+	return encode_64c1(r_c);
+}
+AC_INLINE uint64c1_t u_and_64c1(uint64c1_t x_c1, uint64c1_t y_c1)
+{
+	//Diversify logic operations
+	uint64_t x_d1 = u_decode_64c1(x_c1);
+	uint64_t y_d1 = u_decode_64c1(y_c1);
+	uint64_t r_c = 0xFFFFFFFFFFFFFFFF - ((0xFFFFFFFFFFFFFFFF - x_d1) |
+					     (0xFFFFFFFFFFFFFFFF - y_d1));
+	return u_encode_64c1(r_c);
+}
+
+AC_INLINE int64c1_t or_64c1(int64c1_t x_c1, int64c1_t y_c1)
+{
+	//Diversify logic operations
+	int64_t x_d1 = decode_64c1(x_c1);
+	int64_t y_d1 = decode_64c1(y_c1);
+	int64_t r_c = -1 - ((-1 - x_d1) & (-1 - y_d1));
+	return encode_64c1(r_c);
+}
+AC_INLINE uint64c1_t u_or_64c1(uint64c1_t x_c1, uint64c1_t y_c1)
+{
+	//Diversify logic operations
+	uint64_t x_d1 = u_decode_64c1(x_c1);
+	uint64_t y_d1 = u_decode_64c1(y_c1);
+	uint64_t r_c = 0xFFFFFFFFFFFFFFFF - ((0xFFFFFFFFFFFFFFFF - x_d1) &
+					     (0xFFFFFFFFFFFFFFFF - y_d1));
+	return u_encode_64c1(r_c);
+}
+
+AC_INLINE int64c1_t neg_64c1(int64c1_t x_c1)
+{
+	//Diversify logic operations
+	int64_t x_d1 = decode_64c1(x_c1);
+	int64_t r_c = -1 - x_d1;
+	return encode_64c1(r_c);
+}
+AC_INLINE uint64c1_t u_neg_64c1(uint64c1_t x_c1)
+{
+	//Diversify logic operations
+	uint64_t x_d1 = u_decode_64c1(x_c1);
+	uint64_t r_c = 0xFFFFFFFFFFFFFFFF - x_d1;
+	return u_encode_64c1(r_c);
+}
+
+AC_INLINE int64c1_t xor_64c1(int64c1_t x_c1, int64c1_t y_c1)
+{
+	int64c1_t p1 = and_64c1(neg_64c1(x_c1), y_c1);
+	int64c1_t p2 = and_64c1(x_c1, neg_64c1(y_c1));
+	int64c1_t r_c1 = or_64c1(p1, p2);
+	return r_c1;
+}
+AC_INLINE uint64c1_t u_xor_64c1(uint64c1_t x_c1, uint64c1_t y_c1)
+{
+	uint64c1_t p1 = u_and_64c1(u_neg_64c1(x_c1), y_c1);
+	uint64c1_t p2 = u_and_64c1(x_c1, u_neg_64c1(y_c1));
+	uint64c1_t r_c1 = u_or_64c1(p1, p2);
+	return r_c1;
+}
+
+AC_BATCH_DEFINE_OPS(64c1, int64c1_t, uint64c1_t, int64_t, uint64_t)
+AC_BATCH_DEFINE_CHECK(64c1, int64c1_t, uint64c1_t, int64_t, uint64_t)
+
+#endif //ANLIMB64_H_
@@ -0,0 +1,97 @@
+/**
+ * @copyright: (c) 2022, Institute for Control Engineering of Machine Tools and Manufacturing Units,
+ *             University of Stuttgart
+ *             All rights reserved. Licensed under the Apache License, Version 2.0 (the "License");
+ *             you may not use this file except in compliance with the License.
+ *             You may obtain a copy of the License at
+ *                  http://www.apache.org/licenses/LICENSE-2.0
+ *             Unless required by applicable law or agreed to in writing, software
+ *             distributed under the License is distributed on an "AS IS" BASIS,
+ *             WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *             See the License for the specific language governing permissions and
+ *             limitations under the License.
+ * @author: Marc Fischer <marc.fischer@isw.uni-stuttgart.de>
+ * @description: Derives all constants of the AN-Encoding from A at compile time.
+ *               an_param_32.h and an_param_64.h generate the AN operations for one A and can be included several
+ *               times with different A, e.g.
+ *                   #define AN_PARAM_A 59665
+ *                   #define AN_PARAM_SFX 32a59665
+ *                   #include "an_param_32.h"
+ *               generates encode_32a59665(), u_mul_32a59665(), ... The constants are integer constant expressions,
+ *               so they are folded by the compiler independent of the optimization level.
+ */
+
+#ifndef ANPARAM_H_
+#define ANPARAM_H_
+
+#include <stdint.h>
+#include "common.h"
+
+#define AC_AN_CAT_(a, b) a##b
+#define AC_AN_CAT(a, b) AC_AN_CAT_(a, b)
+#define AC_AN_STR_(a) #a
+#define AC_AN_STR(a) AC_AN_STR_(a)
+
+#ifdef __cplusplus
+#define AC_AN_STATIC_ASSERT(c, msg) static_assert(c, msg)
+#else
+#define AC_AN_STATIC_ASSERT(c, msg) _Static_assert(c, msg)
+#endif
+
+// A^-1 mod 2^n by Newton iteration. x=A is correct in the lowest 3 bits, every step doubles the correct bits.
+#define AC_AN_NEWTON(T, a, x) ((T)(x) * ((T)2 - (T)(a) * (T)(x)))
+#define AC_AN_INV_3TO48(T, a)                                                  \
+	AC_AN_NEWTON(T, a,                                                     \
+		     AC_AN_NEWTON(T, a,                                        \
+				  AC_AN_NEWTON(T, a, AC_AN_NEWTON(T, a, a))))
+
+// Constants for 32 bit values (64 bit code words)
+// ceil(log2(A))
+#define AC_AN32_SHIFT(a) (64 - __builtin_clzll((uint64_t)(a)-1))
+// Magic number for the round-up division by A: floor(2^(64+shift)/A)+1-2^64
+#define AC_AN32_MAGIC(a)                                                       \
+	((uint64_t)((((__uint128_t)1 << (64 + AC_AN32_SHIFT(a))) / (a)) + 1))
+// A^-1 mod 2^64
+#define AC_AN32_INV(a) AC_AN_NEWTON(uint64_t, a, AC_AN_INV_3TO48(uint64_t, a))
+// floor((2^63-1)/A) and floor((2^64-1)/A). x*A^-1 mod 2^64 is in this range iff x is a multiple of A
+#define AC_AN32_BOUND(a) ((uint64_t)INT64_MAX / (uint64_t)(a))
+#define AC_AN32_BOUND_U(a) (UINT64_MAX / (uint64_t)(a))
+// 2^32(2^32-A) mod 2^64, correction of the overflows
+#define AC_AN32_SUB(a) ((uint64_t)0 - ((uint64_t)(a) << 32))
+// 2^32*A
+#define AC_AN32_POWA(a) ((int64_t)(a) << 32)
+
+// Constants for 64 bit values (128 bit code words)
+// floor(log2(A))
+#define AC_AN64_SHIFT(a) (63 - __builtin_clzll((uint64_t)(a)))
+// Magic number for the division by A: floor(2^(128+shift)/A)+1. The 256 bit dividend is divided in two steps.
+#define AC_AN64_POW(a) ((__uint128_t)1 << (64 + AC_AN64_SHIFT(a)))
+#define AC_AN64_MAGIC(a)                                                       \
+	(((AC_AN64_POW(a) / (a)) << 64) +                                      \
+	 ((AC_AN64_POW(a) % (a)) << 64) / (a) + 1)
+// A^-1 mod 2^128
+#define AC_AN64_INV(a)                                                         \
+	AC_AN_NEWTON(__uint128_t, a,                                           \
+		     AC_AN_NEWTON(__uint128_t, a,                              \
+				  AC_AN_INV_3TO48(__uint128_t, a)))
+// floor((2^127-1)/A) and floor((2^128-1)/A)
+#define AC_AN64_BOUND(a) ((~(__uint128_t)0 >> 1) / (a))
+#define AC_AN64_BOUND_U(a) (~(__uint128_t)0 / (a))
+// 2^64(2^64-A) mod 2^128, correction of the overflows
+#define AC_AN64_SUB(a) ((__uint128_t)(0 - (uint64_t)(a)) << 64)
+// 2^64*A
+#define AC_AN64_POWA(a) ((__uint128_t)(a) << 64)
+
+// x < y for 128 bit code words. Compares the 64 bit halves, as the 128 bit compare is branching without optimization.
+AC_INLINE int ac_an_ult128(__uint128_t x, __uint128_t y)
+{
+	uint64_t xh = (uint64_t)(x >> 64), yh = (uint64_t)(y >> 64);
+	return (xh < yh) | ((xh == yh) & ((uint64_t)x < (uint64_t)y));
+}
+AC_INLINE int ac_an_slt128(__int128_t x, __int128_t y)
+{
+	int64_t xh = (int64_t)(x >> 64), yh = (int64_t)(y >> 64);
+	return (xh < yh) | ((xh == yh) & ((uint64_t)x < (uint64_t)y));
+}
+
+#endif //ANPARAM_H_
@@ -0,0 +1,393 @@
+/**
+ * @copyright: (c) 2022, Institute for Control Engineering of Machine Tools and Manufacturing Units,
+ *             University of Stuttgart
+ *             All rights reserved. Licensed under the Apache License, Version 2.0 (the "License");
+ *             you may not use this file except in compliance with the License.
+ *             You may obtain a copy of the License at
+ *                  http://www.apache.org/licenses/LICENSE-2.0
+ *             Unless required by applicable law or agreed to in writing, software
+ *             distributed under the License is distributed on an "AS IS" BASIS,
+ *             WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *             See the License for the specific language governing permissions and
+ *             limitations under the License.
+ * @author: Marc Fischer <marc.fischer@isw.uni-stuttgart.de>
+ * @description: Generates all primitive functions for AN-Encoding of one channel for 32 bit values.
+ *               AN_PARAM_A (odd, 1 < A < 2^31) and the function suffix AN_PARAM_SFX have to be defined before
+ *               the include. The header has no include guard and can be included once per A, see an_param.h.
+ *               All constants are derived from A, decode and check are division-free.
+ */
+
+#include <stdint.h>
+#include <stdlib.h>
+#include "common.h"
+#include "batch.h"
+#include "checkpoint.h"
+#include "an_param.h"
+
+#if !defined(AN_PARAM_A) || !defined(AN_PARAM_SFX)
+#error "AN_PARAM_A and AN_PARAM_SFX must be defined before including an_param_32.h"
+#endif
+
+#ifndef ANPARAM32_TYPES_
+#define ANPARAM32_TYPES_
+typedef uint64_t uint32c1_t;
+typedef int64_t int32c1_t;
+#endif //ANPARAM32_TYPES_
+
+#define AC_AN_A (AN_PARAM_A)
+#define AN_FN(fun) AC_AN_CAT(fun##_, AN_PARAM_SFX)
+
+AC_AN_STATIC_ASSERT((AC_AN_A & 1) && AC_AN_A > 1 && AC_AN_A < 0x80000000L,
+		    "A must be odd and 1 < A < 2^31");
+
+// floor(x/A) for every 64 bit value
+AC_INLINE uint64_t AN_FN(u_magicdiv)(uint64_t x)
+{
+	uint64_t t = (uint64_t)(((__uint128_t)x * AC_AN32_MAGIC(AC_AN_A)) >>
+				64);
+	return (t + ((x - t) >> 1)) >> (AC_AN32_SHIFT(AC_AN_A) - 1);
+}
+// x/A rounded towards zero, identical to the C division
+AC_INLINE int64_t AN_FN(magicdiv)(int64_t x)
+{
+	uint64_t sign = (uint64_t)(x >> 63);
+	uint64_t q = AN_FN(u_magicdiv)(((uint64_t)x ^ sign) - sign);
+	return (int64_t)((q ^ sign) - sign);
+}
+
+// x % A == 0
+AC_INLINE int AN_FN(divisible)(int64_t x)
+{
+	return (uint64_t)x * AC_AN32_INV(AC_AN_A) + AC_AN32_BOUND(AC_AN_A) <=
+	       2 * AC_AN32_BOUND(AC_AN_A);
+}
+AC_INLINE int AN_FN(u_divisible)(uint64_t x)
+{
+	return x * AC_AN32_INV(AC_AN_A) <= AC_AN32_BOUND_U(AC_AN_A);
+}
+// x % A for every 64 bit value
+AC_INLINE uint64_t AN_FN(ckpt_mod)(uint64_t x)
+{
+	return x - AN_FN(u_magicdiv)(x) * AC_AN_A;
+}
+
+AC_INLINE int32c1_t AN_FN(encode)(int32_t x)
+{
+	int32c1_t r_c1 = (int32c1_t)AC_AN_A * (int32c1_t)x;
+	return r_c1;
+}
+AC_INLINE uint32c1_t AN_FN(u_encode)(uint32_t x)
+{
+	uint32c1_t r_c1 = (uint32c1_t)(x) * (uint32c1_t)(AC_AN_A);
+	return r_c1;
+}
+
+AC_INLINE int32_t AN_FN(decode)(int32c1_t x_c1)
+{
+	int32_t r = (int32_t)AN_FN(magicdiv)(x_c1);
+	return r;
+}
+AC_INLINE uint32_t AN_FN(u_decode)(uint32c1_t x_c1)
+{
+	uint32_t r = AN_FN(u_magicdiv)(x_c1);
+	return r;
+}
+
+AC_INLINE int AN_FN(check)(int32c1_t val, int32c1_t valc)
+{
+	return (val == AN_FN(decode)(valc)) && AN_FN(divisible)(valc);
+}
+AC_INLINE int AN_FN(u_check)(uint32c1_t val, uint32c1_t valc)
+{
+	return val == AN_FN(u_decode)(valc) && AN_FN(u_divisible)(valc);
+}
+
+AC_INLINE int32c1_t AN_FN(add)(int32c1_t x_c1, int32c1_t y_c1)
+{
+	return x_c1 + y_c1;
+}
+AC_INLINE uint32c1_t AN_FN(u_add)(uint32c1_t x_c1, uint32c1_t y_c1)
+{
+	return x_c1 + y_c1;
+}
+
+AC_INLINE int32c1_t AN_FN(sub)(int32c1_t x_c1, int32c1_t y_c1)
+{
+	return x_c1 - y_c1;
+}
+AC_INLINE uint32c1_t AN_FN(u_sub)(uint32c1_t x_c1, uint32c1_t y_c1)
+{
+	uint32c1_t r_c1 = x_c1 - y_c1;
+	if (x_c1 < y_c1) {
+		r_c1 = r_c1 - AC_AN32_SUB(AC_AN_A); //2^64-A*2^32=2^32(2^32-A)
+	}
+	return r_c1;
+}
+
+AC_INLINE int32c1_t AN_FN(mul)(int32c1_t x_c1, int32c1_t y_c1)
+{
+	int32c1_t x_d1 = AN_FN(magicdiv)(x_c1);
+	int32c1_t y_d1 = AN_FN(magicdiv)(y_c1);
+	int32_t res = (int32_t)x_d1 * (int32_t)y_d1;
+
+	int32c1_t r = x_d1 * y_d1;
+	int32c1_t quo = (r + ((r >> 63) & 0xFFFFFFFFL)) >>
+			32; //r/2^32 rounded towards zero
+	int32c1_t r_c1 =
+		x_c1 * y_d1 -
+		quo * AC_AN32_POWA(AC_AN_A); //(quo*(int32c1_t)(4294967296))*(int32c1_t)(A)
+
+	if (r > 0) {
+		if (res < 0) {
+			r_c1 = r_c1 +
+			       AC_AN32_SUB(AC_AN_A); //2^32(2^32-A)
+		}
+	} else {
+		if (res > 0) {
+			r_c1 = r_c1 -
+			       AC_AN32_SUB(AC_AN_A); //2^32(2^32-A)
+		}
+	}
+
+	return r_c1;
+}
+AC_INLINE uint32c1_t AN_FN(u_mul)(uint32c1_t x_c1, uint32c1_t y_c1)
+{
+	uint32c1_t x_d1 = AN_FN(u_magicdiv)(x_c1);
+	uint32c1_t y_d1 = AN_FN(u_magicdiv)(y_c1);
+
+	uint32c1_t r = x_d1 * y_d1;
+	uint32c1_t quo = r >> 32; //r/2^32
+	uint32c1_t r_c1 =
+		x_c1 * y_d1 -
+		quo * AC_AN32_POWA(AC_AN_A); //(quo*(uint32c1_t)(4294967296))*(uint32c1_t)(A)
+
+	return r_c1;
+}
+
+AC_INLINE int32c1_t AN_FN(div)(int32c1_t x_c1, int32c1_t y_c1)
+{
+	int32c1_t r_c1 = (x_c1 / y_c1) * AC_AN_A;
+	return r_c1;
+}
+AC_INLINE uint32c1_t AN_FN(u_div)(uint32c1_t x_c1, uint32c1_t y_c1)
+{
+	uint32c1_t r_c1 = (x_c1 / y_c1) * AC_AN_A;
+	return r_c1;
+}
+
+AC_INLINE int32c1_t AN_FN(mod)(int32c1_t x_c1, int32c1_t y_c1)
+{
+	return x_c1 % y_c1;
+}
+AC_INLINE uint32c1_t AN_FN(u_mod)(uint32c1_t x_c1, uint32c1_t y_c1)
+{
+	return x_c1 % y_c1;
+}
+
+AC_INLINE int32c1_t AN_FN(eq)(int32c1_t x_c1, int32c1_t y_c1)
+{
+	int32c1_t r_c1 = AC_AN_A & AC_MASK(int32c1_t, x_c1 == y_c1);
+	return r_c1;
+}
+AC_INLINE uint32c1_t AN_FN(u_eq)(uint32c1_t x_c1, uint32c1_t y_c1)
+{
+	uint32c1_t r_c1 = AC_AN_A & AC_MASK(uint32c1_t, x_c1 == y_c1);
+	return r_c1;
+}
+
+AC_INLINE int32c1_t AN_FN(neq)(int32c1_t x_c1, int32c1_t y_c1)
+{
+	int32c1_t r_c1 = AC_AN_A & AC_MASK(int32c1_t, x_c1 != y_c1);
+	return r_c1;
+}
+AC_INLINE uint32c1_t AN_FN(u_neq)(uint32c1_t x_c1, uint32c1_t y_c1)
+{
+	uint32c1_t r_c1 = AC_AN_A & AC_MASK(uint32c1_t, x_c1 != y_c1);
+	return r_c1;
+}
+
+AC_INLINE int32c1_t AN_FN(less)(int32c1_t x_c1, int32c1_t y_c1)
+{
+	int32c1_t r_c1 = AC_AN_A & AC_MASK(int32c1_t, x_c1 < y_c1);
+	return r_c1;
+}
+AC_INLINE uint32c1_t AN_FN(u_less)(uint32c1_t x_c1, uint32c1_t y_c1)
+{
+	uint32c1_t r_c1 = AC_AN_A & AC_MASK(uint32c1_t, x_c1 < y_c1);
+	return r_c1;
+}
+
+AC_INLINE int32c1_t AN_FN(grt)(int32c1_t x_c1, int32c1_t y_c1)
+{
+	int32c1_t r_c1 = AC_AN_A & AC_MASK(int32c1_t, x_c1 > y_c1);
+	return r_c1;
+}
+AC_INLINE uint32c1_t AN_FN(u_grt)(uint32c1_t x_c1, uint32c1_t y_c1)
+{
+	uint32c1_t r_c1 = AC_AN_A & AC_MASK(uint32c1_t, x_c1 > y_c1);
+	return r_c1;
+}
+
+AC_INLINE int32c1_t AN_FN(leq)(int32c1_t x_c1, int32c1_t y_c1)
+{
+	int32c1_t r_c1 = AC_AN_A & AC_MASK(int32c1_t, x_c1 <= y_c1);
+	return r_c1;
+}
+AC_INLINE uint32c1_t AN_FN(u_leq)(uint32c1_t x_c1, uint32c1_t y_c1)
+{
+	uint32c1_t r_c1 = AC_AN_A & AC_MASK(uint32c1_t, x_c1 <= y_c1);
+	return r_c1;
+}
+
+AC_INLINE int32c1_t AN_FN(geq)(int32c1_t x_c1, int32c1_t y_c1)
+{
+	int32c1_t r_c1 = AC_AN_A & AC_MASK(int32c1_t, x_c1 >= y_c1);
+	return r_c1;
+}
+AC_INLINE uint32c1_t AN_FN(u_geq)(uint32c1_t x_c1, uint32c1_t y_c1)
+{
+	uint32c1_t r_c1 = AC_AN_A & AC_MASK(uint32c1_t, x_c1 >= y_c1);
+	return r_c1;
+}
+
+AC_INLINE int32c1_t AN_FN(shl)(int32c1_t x_c1, int32c1_t y_c1)
+{
+	int32c1_t y = AN_FN(decode)(y_c1);
+	int32c1_t r_c1 =
+		AN_FN(mul)(x_c1, ((int32c1_t)1 << y) * (int32c1_t)AC_AN_A);
+	return r_c1; // result already AN-encoded
+}
+AC_INLINE uint32c1_t AN_FN(u_shl)(uint32c1_t x_c1, uint32c1_t y_c1)
+{
+	uint32c1_t y = AN_FN(u_decode)(y_c1);
+	uint32c1_t r_c1 =
+		AN_FN(u_mul)(x_c1,
+			     ((uint32c1_t)1 << (y)) * (uint32c1_t)AC_AN_A);
+
+	return r_c1;
+}
+
+//INFO:	The behaviour of the signed right shift depends on the compiler implementation. Therfore this operation is not
+//		supported and is prohibited.
+
+AC_INLINE uint32c1_t AN_FN(u_shr)(uint32c1_t x_c1, uint32c1_t y_c1)
+{
+	uint32c1_t y = AN_FN(u_decode)(y_c1);
+	uint32c1_t r_c1 =
+		AN_FN(u_div)(x_c1, ((uint32c1_t)1 << y) * (uint32c1_t)AC_AN_A);
+
+	return r_c1;
+}
+
+AC_INLINE int32c1_t AN_FN(land)(int32c1_t x_c1, int32c1_t y_c1)
+{
+	int32c1_t r_c1 = AN_FN(mul)(x_c1, y_c1);
+	r_c1 = AC_AN_A & AC_MASK(int32c1_t, r_c1 != 0);
+	return r_c1;
+}
+AC_INLINE uint32c1_t AN_FN(u_land)(uint32c1_t x_c1, uint32c1_t y_c1)
+{
+	uint32c1_t r_c1 = AN_FN(u_mul)(x_c1, y_c1);
+	r_c1 = AC_AN_A & AC_MASK(uint32c1_t, r_c1 != 0);
+	return r_c1;
+}
+/*	OR Table
+ * 	| x | Y | Result |
+ *	| 0 | 0 |   0    |
+ *	| 0 |!=0| ENC(1) |
+ *	|!=0| 0 | ENC(1) |
+ *	|!=0|!=0| ENC(1) |
+ */
+AC_INLINE int32c1_t AN_FN(lor)(int32c1_t x_c1, int32c1_t y_c1)
+{
+	//x + y can wrap to 0 although the result is true, so the operands are tested directly
+	int32c1_t r_c1 = AC_AN_A & AC_MASK(int32c1_t, (x_c1 | y_c1) != 0);
+	return r_c1;
+}
+AC_INLINE uint32c1_t AN_FN(u_lor)(uint32c1_t x_c1, uint32c1_t y_c1)
+{
+	//x + y can wrap to 0 although the result is true, so the operands are tested directly
+	uint32c1_t r_c1 = AC_AN_A & AC_MASK(uint32c1_t, (x_c1 | y_c1) != 0);
+	return r_c1;
+}
+
+AC_INLINE int32c1_t AN_FN(and)(int32c1_t x_c1, int32c1_t y_c1)
+{
+	//Diversify logic operations
+	int32_t x_d1 = AN_FN(decode)(x_c1);
+	int32_t y_d1 = AN_FN(decode)(y_c1);
+	int32c1_t r_c = -1 - ((-1 - x_d1) | (-1 - y_d1));
+	return r_c * AC_AN_A;
+}
+AC_INLINE uint32c1_t AN_FN(u_and)(uint32c1_t x_c1, uint32c1_t y_c1)
+{
+	//Diversify logic operations
+	uint32_t x_d1 = AN_FN(u_decode)(x_c1);
+	uint32_t y_d1 = AN_FN(u_decode)(y_c1);
+	uint32c1_t r_c =
+		0xFFFFFFFF - ((0xFFFFFFFF - x_d1) | (0xFFFFFFFF - y_d1));
+	return r_c * AC_AN_A;
+}
+
+AC_INLINE int32c1_t AN_FN(or)(int32c1_t x_c1, int32c1_t y_c1)
+{
+	//Diversify logic operations
+	int32_t x_d1 = AN_FN(decode)(x_c1);
+	int32_t y_d1 = AN_FN(decode)(y_c1);
+	int32c1_t r_c = -1 - ((-1 - x_d1) & (-1 - y_d1));
+	return r_c * AC_AN_A;
+}
+AC_INLINE uint32c1_t AN_FN(u_or)(uint32c1_t x_c1, uint32c1_t y_c1)
+{
+	//Diversify logic operations
+	uint32_t x_d1 = AN_FN(u_decode)(x_c1);
+	uint32_t y_d1 = AN_FN(u_decode)(y_c1);
+	uint32c1_t r_c =
+		0xFFFFFFFF - ((0xFFFFFFFF - x_d1) & (0xFFFFFFFF - y_d1));
+	return r_c * AC_AN_A;
+}
+
+AC_INLINE int32c1_t AN_FN(neg)(int32c1_t x_c1)
+{
+	//Diversify logic operations
+	int32_t x_d1 = AN_FN(decode)(x_c1);
+	int32c1_t r_c = -1 - x_d1;
+	return r_c * AC_AN_A;
+}
+AC_INLINE uint32c1_t AN_FN(u_neg)(uint32c1_t x_c1)
+{
+	//Diversify logic operations
+	uint32_t x_d1 = AN_FN(u_decode)(x_c1);
+	uint32c1_t r_c = 0xFFFFFFFF - x_d1;
+	return r_c * AC_AN_A;
+}
+
+AC_INLINE int32c1_t AN_FN(xor)(int32c1_t x_c1, int32c1_t y_c1)
+{
+	int32c1_t p1 = AN_FN(and)(AN_FN(neg)(x_c1), y_c1);
+	int32c1_t p2 = AN_FN(and)(x_c1, AN_FN(neg)(y_c1));
+	int32c1_t r_c1 = AN_FN(or)(p1, p2);
+	return r_c1;
+}
+AC_INLINE uint32c1_t AN_FN(u_xor)(uint32c1_t x_c1, uint32c1_t y_c1)
+{
+	uint32c1_t p1 = AN_FN(u_and)(AN_FN(u_neg)(x_c1), y_c1);
+	uint32c1_t p2 = AN_FN(u_and)(x_c1, AN_FN(u_neg)(y_c1));
+	uint32c1_t r_c1 = AN_FN(u_or)(p1, p2);
+	return r_c1;
+}
+
+#define AN_BATCH(sfx)                                                          \
+	AC_BATCH_DEFINE_OPS(sfx, int32c1_t, uint32c1_t, int32_t, uint32_t)     \
+	AC_BATCH_DEFINE_CHECK(sfx, int32c1_t, uint32c1_t, int32c1_t,           \
+			      uint32c1_t)                                      \
+	AC_CKPT_DEFINE_AN(sfx, int32c1_t, uint32c1_t, AC_AN_A,                 \
+			  AN_FN(ckpt_mod))
+AN_BATCH(AN_PARAM_SFX)
+
+#undef AN_BATCH
+#undef AN_FN
+#undef AC_AN_A
+#undef AN_PARAM_SFX
+#undef AN_PARAM_A
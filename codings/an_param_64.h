@@ -0,0 +1,439 @@
+/**
+ * @copyright: (c) 2022, Institute for Control Engineering of Machine Tools and Manufacturing Units,
+ *             University of Stuttgart
+ *             All rights reserved. Licensed under the Apache License, Version 2.0 (the "License");
+ *             you may not use this file except in compliance with the License.
+ *             You may obtain a copy of the License at
+ *                  http://www.apache.org/licenses/LICENSE-2.0
+ *             Unless required by applicable law or agreed to in writing, software
+ *             distributed under the License is distributed on an "AS IS" BASIS,
+ *             WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *             See the License for the specific language governing permissions and
+ *             limitations under the License.
+ * @author: Marc Fischer <marc.fischer@isw.uni-stuttgart.de>
+ * @description: Generates all primitive functions for AN-Encoding of one channel for 64 bit values.
+ *               AN_PARAM_A (odd, 1 < A < 2^63) and the function suffix AN_PARAM_SFX have to be defined before
+ *               the include. The header has no include guard and can be included once per A, see an_param.h.
+ *               All constants are derived from A, decode and check are division-free.
+ */
+
+#include <stdint.h>
+#include <stdlib.h>
+#include "common.h"
+#include "batch.h"
+#include "checkpoint.h"
+#include "an_param.h"
+
+#if !defined(AN_PARAM_A) || !defined(AN_PARAM_SFX)
+#error "AN_PARAM_A and AN_PARAM_SFX must be defined before including an_param_64.h"
+#endif
+
+#ifndef ANPARAM64_TYPES_
+#define ANPARAM64_TYPES_
+typedef __uint128_t uint64c1_t;
+typedef __int128_t int64c1_t;
+#endif //ANPARAM64_TYPES_
+
+#define AC_AN_A (AN_PARAM_A)
+#define AN_FN(fun) AC_AN_CAT(fun##_, AN_PARAM_SFX)
+
+AC_AN_STATIC_ASSERT((AC_AN_A & 1) && AC_AN_A > 1 &&
+			    AC_AN_A < 0x8000000000000000UL,
+		    "A must be odd and 1 < A < 2^63");
+
+// High 128 bits of the 256 bit product a*b, composed of 64x64->128 bit multiplications
+AC_INLINE uint64c1_t AN_FN(mulhi)(uint64c1_t a, uint64c1_t b)
+{
+	uint64_t a0 = (uint64_t)a;
+	uint64_t a1 = (uint64_t)(a >> 64);
+	uint64_t b0 = (uint64_t)b;
+	uint64_t b1 = (uint64_t)(b >> 64);
+	uint64c1_t p00 = (uint64c1_t)a0 * b0;
+	uint64c1_t p01 = (uint64c1_t)a0 * b1;
+	uint64c1_t p10 = (uint64c1_t)a1 * b0;
+	uint64c1_t p11 = (uint64c1_t)a1 * b1;
+	uint64c1_t mid = (p00 >> 64) + (uint64_t)p01 + (uint64_t)p10;
+	return p11 + (p01 >> 64) + (p10 >> 64) + (mid >> 64);
+}
+
+// floor(x/A) for x <= 2^127, which covers all code words
+AC_INLINE uint64c1_t AN_FN(u_magicdiv)(uint64c1_t x)
+{
+	return AN_FN(mulhi)(x, AC_AN64_MAGIC(AC_AN_A)) >>
+	       AC_AN64_SHIFT(AC_AN_A);
+}
+// x/A rounded towards zero, identical to the C division
+AC_INLINE int64c1_t AN_FN(magicdiv)(int64c1_t x)
+{
+	uint64c1_t sign = (uint64c1_t)(x >> 127);
+	uint64c1_t q = AN_FN(u_magicdiv)(((uint64c1_t)x ^ sign) - sign);
+	return (int64c1_t)((q ^ sign) - sign);
+}
+
+// x % A == 0
+AC_INLINE int AN_FN(divisible)(int64c1_t x)
+{
+	return (uint64c1_t)x * AC_AN64_INV(AC_AN_A) + AC_AN64_BOUND(AC_AN_A) <=
+	       2 * AC_AN64_BOUND(AC_AN_A);
+}
+AC_INLINE int AN_FN(u_divisible)(uint64c1_t x)
+{
+	return x * AC_AN64_INV(AC_AN_A) <= AC_AN64_BOUND_U(AC_AN_A);
+}
+// x % A for x <= 2^127
+AC_INLINE uint64c1_t AN_FN(ckpt_mod)(uint64c1_t x)
+{
+	return x - AN_FN(u_magicdiv)(x) * AC_AN_A;
+}
+
+AC_INLINE int64c1_t AN_FN(encode)(int64_t x)
+{
+	int64c1_t r_c1 = (int64c1_t)AC_AN_A * (int64c1_t)x;
+	return r_c1;
+}
+AC_INLINE uint64c1_t AN_FN(u_encode)(uint64_t x)
+{
+	uint64c1_t r_c1 = (uint64c1_t)(x) * (uint64c1_t)(AC_AN_A);
+	return r_c1;
+}
+
+AC_INLINE int64_t AN_FN(decode)(int64c1_t x_c1)
+{
+	int64_t r = (int64_t)AN_FN(magicdiv)(x_c1);
+	return r;
+}
+AC_INLINE uint64_t AN_FN(u_decode)(uint64c1_t x_c1)
+{
+	uint64_t r = AN_FN(u_magicdiv)(x_c1);
+	return r;
+}
+
+AC_INLINE int AN_FN(check)(int64c1_t val, int64c1_t valc)
+{
+	return (val == AN_FN(decode)(valc)) && AN_FN(divisible)(valc);
+}
+AC_INLINE int AN_FN(u_check)(uint64c1_t val, uint64c1_t valc)
+{
+	return val == AN_FN(u_decode)(valc) && AN_FN(u_divisible)(valc);
+}
+
+AC_INLINE int64c1_t AN_FN(add)(int64c1_t x_c1, int64c1_t y_c1)
+{
+	return x_c1 + y_c1;
+}
+AC_INLINE uint64c1_t AN_FN(u_add)(uint64c1_t x_c1, uint64c1_t y_c1)
+{
+	return x_c1 + y_c1;
+}
+
+AC_INLINE int64c1_t AN_FN(sub)(int64c1_t x_c1, int64c1_t y_c1)
+{
+	return x_c1 - y_c1;
+}
+AC_INLINE uint64c1_t AN_FN(u_sub)(uint64c1_t x_c1, uint64c1_t y_c1)
+{
+	uint64c1_t r_c1 = x_c1 - y_c1;
+	if (x_c1 < y_c1) {
+		//2^64(2^64-A)
+		//Due to Performance reasons this calcualtion is precalculated. As it depends on A we have to recalculate it if a changes
+		r_c1 = r_c1 - AC_AN64_SUB(AC_AN_A);
+	}
+	return r_c1;
+}
+
+AC_INLINE int64c1_t AN_FN(mul)(int64c1_t x_c1, int64c1_t y_c1)
+{
+	int64c1_t x_d1 = AN_FN(magicdiv)(x_c1);
+	int64c1_t y_d1 = AN_FN(magicdiv)(y_c1);
+	int64_t res = (int64_t)x_d1 * (int64_t)y_d1;
+
+	int64c1_t r = x_d1 * y_d1;
+	int64c1_t quo = (r + ((r >> 127) & 0xFFFFFFFFFFFFFFFFUL)) >>
+			64; //r/2^64 rounded towards zero
+	int64c1_t r_c1 =
+		x_c1 * y_d1 -
+		quo * ((int64c1_t)
+			       AC_AN64_POWA(AC_AN_A)); //(quo*(int64c1_t)(2^64))*(int64c1_t)(AC_AN_A);
+
+	if (r > 0) {
+		if (res < 0) {
+			r_c1 = r_c1 +
+			       AC_AN64_SUB(AC_AN_A); //(int64c1_t)(2^64)*((int64c1_t)(2^64)-(int64c1_t)(AC_AN_A));
+		}
+	} else {
+		if (res > 0) {
+			r_c1 = r_c1 -
+			       AC_AN64_SUB(AC_AN_A); //(int64c1_t)(2^64)*((int64c1_t)(2^64)-(int64c1_t)(AC_AN_A));
+		}
+	}
+
+	return r_c1;
+}
+AC_INLINE uint64c1_t AN_FN(u_mul)(uint64c1_t x_c1, uint64c1_t y_c1)
+{
+	uint64c1_t x_d1 = AN_FN(u_magicdiv)(x_c1);
+	uint64c1_t y_d1 = AN_FN(u_magicdiv)(y_c1);
+
+	uint64c1_t r = x_d1 * y_d1;
+	uint64c1_t quo = r >> 64; //r/2^64
+	uint64c1_t r_c1 =
+		x_c1 * y_d1 -
+		quo * ((int64c1_t)
+			       AC_AN64_POWA(AC_AN_A)); //(quo*(uint64c1_t)(2^64))*(uint64c1_t)(AC_AN_A);
+
+	return r_c1;
+}
+
+//(A*x)/(A*y) = x/y. The quotient is calculated with the decoded values by a 64 bit division.
+AC_INLINE int64c1_t AN_FN(quo)(int64c1_t x_c1, int64c1_t y_c1)
+{
+	int64_t x_d1 = (int64_t)AN_FN(magicdiv)(x_c1);
+	int64_t y_d1 = (int64_t)AN_FN(magicdiv)(y_c1);
+	uint64_t x_sign = (uint64_t)(x_d1 >> 63);
+	uint64_t y_sign = (uint64_t)(y_d1 >> 63);
+	//Divide the absolute values, as INT64_MIN/-1 does not fit into 64 bit
+	uint64_t q = (((uint64_t)x_d1 ^ x_sign) - x_sign) /
+		     (((uint64_t)y_d1 ^ y_sign) - y_sign);
+	uint64c1_t sign = (uint64c1_t)(int64c1_t)(int64_t)(x_sign ^ y_sign);
+	return (int64c1_t)(((uint64c1_t)q ^ sign) - sign);
+}
+
+AC_INLINE int64c1_t AN_FN(div)(int64c1_t x_c1, int64c1_t y_c1)
+{
+	int64c1_t r_c1 = AN_FN(quo)(x_c1, y_c1) * AC_AN_A;
+	return r_c1;
+}
+AC_INLINE uint64c1_t AN_FN(u_div)(uint64c1_t x_c1, uint64c1_t y_c1)
+{
+	uint64_t q = (uint64_t)AN_FN(u_magicdiv)(x_c1) /
+		     (uint64_t)AN_FN(u_magicdiv)(y_c1);
+	uint64c1_t r_c1 = (uint64c1_t)q * AC_AN_A;
+	return r_c1;
+}
+
+//A*x-(x/y)*A*y = A*(x%y). Using the encoded x keeps a faulty x detectable.
+AC_INLINE int64c1_t AN_FN(mod)(int64c1_t x_c1, int64c1_t y_c1)
+{
+	return x_c1 - AN_FN(quo)(x_c1, y_c1) * y_c1;
+}
+AC_INLINE uint64c1_t AN_FN(u_mod)(uint64c1_t x_c1, uint64c1_t y_c1)
+{
+	uint64_t q = (uint64_t)AN_FN(u_magicdiv)(x_c1) /
+		     (uint64_t)AN_FN(u_magicdiv)(y_c1);
+	return x_c1 - (uint64c1_t)q * y_c1;
+}
+
+AC_INLINE int64c1_t AN_FN(eq)(int64c1_t x_c1, int64c1_t y_c1)
+{
+	int64c1_t r_c1 = AC_AN_A & AC_MASK(int64c1_t, x_c1 == y_c1);
+	return r_c1;
+}
+AC_INLINE uint64c1_t AN_FN(u_eq)(uint64c1_t x_c1, uint64c1_t y_c1)
+{
+	uint64c1_t r_c1 = AC_AN_A & AC_MASK(uint64c1_t, x_c1 == y_c1);
+	return r_c1;
+}
+
+AC_INLINE int64c1_t AN_FN(neq)(int64c1_t x_c1, int64c1_t y_c1)
+{
+	int64c1_t r_c1 = AC_AN_A & AC_MASK(int64c1_t, x_c1 != y_c1);
+	return r_c1;
+}
+AC_INLINE uint64c1_t AN_FN(u_neq)(uint64c1_t x_c1, uint64c1_t y_c1)
+{
+	uint64c1_t r_c1 = AC_AN_A & AC_MASK(uint64c1_t, x_c1 != y_c1);
+	return r_c1;
+}
+
+AC_INLINE int64c1_t AN_FN(less)(int64c1_t x_c1, int64c1_t y_c1)
+{
+	int c = ac_an_slt128(x_c1, y_c1);
+	int64c1_t r_c1 = AC_AN_A & AC_MASK(int64c1_t, c);
+	return r_c1;
+}
+AC_INLINE uint64c1_t AN_FN(u_less)(uint64c1_t x_c1, uint64c1_t y_c1)
+{
+	int c = ac_an_ult128(x_c1, y_c1);
+	uint64c1_t r_c1 = AC_AN_A & AC_MASK(uint64c1_t, c);
+	return r_c1;
+}
+
+AC_INLINE int64c1_t AN_FN(grt)(int64c1_t x_c1, int64c1_t y_c1)
+{
+	int c = ac_an_slt128(y_c1, x_c1);
+	int64c1_t r_c1 = AC_AN_A & AC_MASK(int64c1_t, c);
+	return r_c1;
+}
+AC_INLINE uint64c1_t AN_FN(u_grt)(uint64c1_t x_c1, uint64c1_t y_c1)
+{
+	int c = ac_an_ult128(y_c1, x_c1);
+	uint64c1_t r_c1 = AC_AN_A & AC_MASK(uint64c1_t, c);
+	return r_c1;
+}
+
+AC_INLINE int64c1_t AN_FN(leq)(int64c1_t x_c1, int64c1_t y_c1)
+{
+	int c = !ac_an_slt128(y_c1, x_c1);
+	int64c1_t r_c1 = AC_AN_A & AC_MASK(int64c1_t, c);
+	return r_c1;
+}
+AC_INLINE uint64c1_t AN_FN(u_leq)(uint64c1_t x_c1, uint64c1_t y_c1)
+{
+	int c = !ac_an_ult128(y_c1, x_c1);
+	uint64c1_t r_c1 = AC_AN_A & AC_MASK(uint64c1_t, c);
+	return r_c1;
+}
+
+AC_INLINE int64c1_t AN_FN(geq)(int64c1_t x_c1, int64c1_t y_c1)
+{
+	int c = !ac_an_slt128(x_c1, y_c1);
+	int64c1_t r_c1 = AC_AN_A & AC_MASK(int64c1_t, c);
+	return r_c1;
+}
+AC_INLINE uint64c1_t AN_FN(u_geq)(uint64c1_t x_c1, uint64c1_t y_c1)
+{
+	int c = !ac_an_ult128(x_c1, y_c1);
+	uint64c1_t r_c1 = AC_AN_A & AC_MASK(uint64c1_t, c);
+	return r_c1;
+}
+
+AC_INLINE int64c1_t AN_FN(shl)(int64c1_t x_c1, int64c1_t y_c1)
+{
+	int64c1_t y = AN_FN(decode)(y_c1);
+	int64c1_t r_c1 =
+		AN_FN(mul)(x_c1, ((int64c1_t)1 << y) * (int64c1_t)AC_AN_A);
+	return r_c1; // result already AN-encoded
+}
+AC_INLINE uint64c1_t AN_FN(u_shl)(uint64c1_t x_c1, uint64c1_t y_c1)
+{
+	uint64c1_t y = AN_FN(u_decode)(y_c1);
+	uint64c1_t r_c1 =
+		AN_FN(u_mul)(x_c1,
+			     ((uint64c1_t)1 << (y)) * (uint64c1_t)AC_AN_A);
+
+	return r_c1;
+}
+
+//INFO:	The behaviour of the signed right shift depends on the compiler implementation. Therfore this operation is not
+//		supported and is prohibited.
+
+AC_INLINE uint64c1_t AN_FN(u_shr)(uint64c1_t x_c1, uint64c1_t y_c1)
+{
+	uint64c1_t y = AN_FN(u_decode)(y_c1);
+	//x/(2^y*A)*A = ((x/A) >> y)*A. The decoded divisor 2^y does not fit into the 64 bit division for y >= 64
+	uint64c1_t r_c1 = (AN_FN(u_magicdiv)(x_c1) >> y) * AC_AN_A;
+
+	return r_c1;
+}
+
+AC_INLINE int64c1_t AN_FN(land)(int64c1_t x_c1, int64c1_t y_c1)
+{
+	int64c1_t r_c1 = AN_FN(mul)(x_c1, y_c1);
+	r_c1 = AC_AN_A & AC_MASK(int64c1_t, r_c1 != 0);
+	return r_c1;
+}
+AC_INLINE uint64c1_t AN_FN(u_land)(uint64c1_t x_c1, uint64c1_t y_c1)
+{
+	uint64c1_t r_c1 = AN_FN(u_mul)(x_c1, y_c1);
+	r_c1 = AC_AN_A & AC_MASK(uint64c1_t, r_c1 != 0);
+	return r_c1;
+}
+/*	OR Table
+ * 	| x | Y | Result |
+ *	| 0 | 0 |   0    |
+ *	| 0 |!=0| ENC(1) |
+ *	|!=0| 0 | ENC(1) |
+ *	|!=0|!=0| ENC(1) |
+ */
+AC_INLINE int64c1_t AN_FN(lor)(int64c1_t x_c1, int64c1_t y_c1)
+{
+	//x + y can wrap to 0 although the result is true, so the operands are tested directly
+	int64c1_t r_c1 = AC_AN_A & AC_MASK(int64c1_t, (x_c1 | y_c1) != 0);
+	return r_c1;
+}
+AC_INLINE uint64c1_t AN_FN(u_lor)(uint64c1_t x_c1, uint64c1_t y_c1)
+{
+	//x + y can wrap to 0 although the result is true, so the operands are tested directly
+	uint64c1_t r_c1 = AC_AN_A & AC_MASK(uint64c1_t, (x_c1 | y_c1) != 0);
+	return r_c1;
+}
+
+AC_INLINE int64c1_t AN_FN(and)(int64c1_t x_c1, int64c1_t y_c1)
+{
+	//Diversify logic operations
+	int64_t x_d1 = AN_FN(decode)(x_c1);
+	int64_t y_d1 = AN_FN(decode)(y_c1);
+	int64c1_t r_c = -1 - ((-1 - x_d1) | (-1 - y_d1));
+	return r_c * AC_AN_A;
+}
+AC_INLINE uint64c1_t AN_FN(u_and)(uint64c1_t x_c1, uint64c1_t y_c1)
+{
+	//Diversify logic operations
+	uint64_t x_d1 = AN_FN(u_decode)(x_c1);
+	uint64_t y_d1 = AN_FN(u_decode)(y_c1);
+	uint64c1_t r_c = 0xFFFFFFFFFFFFFFFF - ((0xFFFFFFFFFFFFFFFF - x_d1) |
+					       (0xFFFFFFFFFFFFFFFF - y_d1));
+	return r_c * AC_AN_A;
+}
+
+AC_INLINE int64c1_t AN_FN(or)(int64c1_t x_c1, int64c1_t y_c1)
+{
+	//Diversify logic operations
+	int64_t x_d1 = AN_FN(decode)(x_c1);
+	int64_t y_d1 = AN_FN(decode)(y_c1);
+	int64c1_t r_c = -1 - ((-1 - x_d1) & (-1 - y_d1));
+	return r_c * AC_AN_A;
+}
+AC_INLINE uint64c1_t AN_FN(u_or)(uint64c1_t x_c1, uint64c1_t y_c1)
+{
+	//Diversify logic operations
+	uint64_t x_d1 = AN_FN(u_decode)(x_c1);
+	uint64_t y_d1 = AN_FN(u_decode)(y_c1);
+	uint64c1_t r_c = 0xFFFFFFFFFFFFFFFF - ((0xFFFFFFFFFFFFFFFF - x_d1) &
+					       (0xFFFFFFFFFFFFFFFF - y_d1));
+	return r_c * AC_AN_A;
+}
+
+AC_INLINE int64c1_t AN_FN(neg)(int64c1_t x_c1)
+{
+	//Diversify logic operations
+	int64_t x_d1 = AN_FN(decode)(x_c1);
+	int64c1_t r_c = -1 - x_d1;
+	return r_c * AC_AN_A;
+}
+AC_INLINE uint64c1_t AN_FN(u_neg)(uint64c1_t x_c1)
+{
+	//Diversify logic operations
+	uint64_t x_d1 = AN_FN(u_decode)(x_c1);
+	uint64c1_t r_c = 0xFFFFFFFFFFFFFFFF - x_d1;
+	return r_c * AC_AN_A;
+}
+
+AC_INLINE int64c1_t AN_FN(xor)(int64c1_t x_c1, int64c1_t y_c1)
+{
+	int64c1_t p1 = AN_FN(and)(AN_FN(neg)(x_c1), y_c1);
+	int64c1_t p2 = AN_FN(and)(x_c1, AN_FN(neg)(y_c1));
+	int64c1_t r_c1 = AN_FN(or)(p1, p2);
+	return r_c1;
+}
+AC_INLINE uint64c1_t AN_FN(u_xor)(uint64c1_t x_c1, uint64c1_t y_c1)
+{
+	uint64c1_t p1 = AN_FN(u_and)(AN_FN(u_neg)(x_c1), y_c1);
+	uint64c1_t p2 = AN_FN(u_and)(x_c1, AN_FN(u_neg)(y_c1));
+	uint64c1_t r_c1 = AN_FN(u_or)(p1, p2);
+	return r_c1;
+}
+
+#define AN_BATCH(sfx)                                                          \
+	AC_BATCH_DEFINE_OPS(sfx, int64c1_t, uint64c1_t, int64_t, uint64_t)     \
+	AC_BATCH_DEFINE_CHECK(sfx, int64c1_t, uint64c1_t, int64c1_t,           \
+			      uint64c1_t)                                      \
+	AC_CKPT_DEFINE_AN(sfx, int64c1_t, uint64c1_t, AC_AN_A,                 \
+			  AN_FN(ckpt_mod))
+AN_BATCH(AN_PARAM_SFX)
+
+#undef AN_BATCH
+#undef AN_FN
+#undef AC_AN_A
+#undef AN_PARAM_SFX
+#undef AN_PARAM_A
@@ -0,0 +1,291 @@
+/**
+ * @copyright: (c) 2022, Institute for Control Engineering of Machine Tools and Manufacturing Units,
+ *             University of Stuttgart
+ *             All rights reserved. Licensed under the Apache License, Version 2.0 (the "License");
+ *             you may not use this file except in compliance with the License.
+ *             You may obtain a copy of the License at
+ *                  http://www.apache.org/licenses/LICENSE-2.0
+ *             Unless required by applicable law or agreed to in writing, software
+ *             distributed under the License is distributed on an "AS IS" BASIS,
+ *             WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *             See the License for the specific language governing permissions and
+ *             limitations under the License.
+ * @author: Marc Fischer <marc.fischer@isw.uni-stuttgart.de>
+ * @description: Generates batch (array) versions of the encoded operations.
+ *               Each batch function exists as an AVX2 kernel and a scalar kernel. The kernel is chosen by the CPU
+ *               features, which are looked up once at program start. By default both kernels loop over the scalar
+ *               AC_INLINE operation of the coding and differ only in the target ISA the loop is compiled for; if
+ *               the compiler vectorizes this loop depends on the operation (the divisions by A and the 128 bit
+ *               arithmetic usually stay scalar). A coding can provide hand-written AVX2 kernels for its hot
+ *               operations with AC_BATCH_DEFINE_OPS_VEC and AC_BATCH_DEFINE_CHECK_VEC. All kernels give the same
+ *               results as the scalar operations.
+ */
+
+#ifndef BATCH_H_
+#define BATCH_H_
+#ifdef __cplusplus
+extern "C" {
+#endif //__cplusplus
+
+#include <stddef.h>
+#include <stdint.h>
+#include "common.h"
+
+// The kernels are compiled with O3 independent of the build type.
+// The AVX2 kernel is additionally compiled for AVX2/BMI2, the scalar kernel for the baseline ISA.
+#ifdef __GNUC__
+#define AC_BATCH_SCALAR __attribute__((optimize("O3"), unused)) static
+#if defined(__x86_64__)
+#include <immintrin.h>
+#define AC_BATCH_HAS_AVX2 1
+#define AC_BATCH_AVX2                                                          \
+	__attribute__((target("avx2,bmi2"), optimize("O3"), unused)) static
+#define AC_BATCH_AVX2_INLINE                                                   \
+	__attribute__((target("avx2,bmi2"), always_inline, unused)) static inline
+#endif
+#else
+#define AC_BATCH_SCALAR static
+#endif
+
+#ifdef AC_BATCH_HAS_AVX2
+// Set once before main. Batch calls from other constructors may run before and take the scalar kernel.
+static int ac_batch_has_avx2;
+__attribute__((constructor, unused)) static void ac_batch_init(void)
+{
+	__builtin_cpu_init();
+	ac_batch_has_avx2 = __builtin_cpu_supports("avx2") != 0;
+}
+#endif
+
+AC_INLINE int ac_batch_avx2(void)
+{
+#ifdef AC_BATCH_HAS_AVX2
+	return ac_batch_has_avx2;
+#else
+	return 0;
+#endif
+}
+
+#ifdef AC_BATCH_HAS_AVX2
+#define AC_BATCH_SELECT(fun, ...)                                              \
+	do {                                                                   \
+		if (ac_batch_avx2()) {                                         \
+			fun##_avx2(__VA_ARGS__);                               \
+		} else {                                                       \
+			fun##_scalar(__VA_ARGS__);                             \
+		}                                                              \
+	} while (0)
+#define AC_BATCH_KERNEL(...) __VA_ARGS__
+
+// Helpers for the hand-written AVX2 kernels, on 64 bit lanes if not stated otherwise
+// x < y unsigned
+AC_BATCH_AVX2_INLINE __m256i ac_v256_ult64(__m256i x, __m256i y)
+{
+	const __m256i sign = _mm256_set1_epi64x(INT64_MIN);
+	return _mm256_cmpgt_epi64(_mm256_xor_si256(y, sign),
+				  _mm256_xor_si256(x, sign));
+}
+// x <= y unsigned
+AC_BATCH_AVX2_INLINE __m256i ac_v256_ule64(__m256i x, __m256i y)
+{
+	return _mm256_xor_si256(ac_v256_ult64(y, x), _mm256_set1_epi64x(-1));
+}
+// Low 64 bits of x*y
+AC_BATCH_AVX2_INLINE __m256i ac_v256_mullo64(__m256i x, __m256i y)
+{
+	__m256i cross = _mm256_add_epi64(
+		_mm256_mul_epu32(_mm256_srli_epi64(x, 32), y),
+		_mm256_mul_epu32(x, _mm256_srli_epi64(y, 32)));
+	return _mm256_add_epi64(_mm256_mul_epu32(x, y),
+				_mm256_slli_epi64(cross, 32));
+}
+// Full 128 bit product of x*y, the high 64 bits are stored in hi
+AC_BATCH_AVX2_INLINE __m256i ac_v256_mul64(__m256i x, __m256i y, __m256i *hi)
+{
+	const __m256i lo32 = _mm256_set1_epi64x(0xffffffff);
+	__m256i xh = _mm256_srli_epi64(x, 32), yh = _mm256_srli_epi64(y, 32);
+	__m256i ll = _mm256_mul_epu32(x, y), lh = _mm256_mul_epu32(x, yh);
+	__m256i hl = _mm256_mul_epu32(xh, y), hh = _mm256_mul_epu32(xh, yh);
+	__m256i mid = _mm256_add_epi64(
+		_mm256_add_epi64(_mm256_srli_epi64(ll, 32),
+				 _mm256_and_si256(lh, lo32)),
+		_mm256_and_si256(hl, lo32));
+	*hi = _mm256_add_epi64(
+		_mm256_add_epi64(hh, _mm256_srli_epi64(mid, 32)),
+		_mm256_add_epi64(_mm256_srli_epi64(lh, 32),
+				 _mm256_srli_epi64(hl, 32)));
+	return _mm256_or_si256(_mm256_slli_epi64(mid, 32),
+			       _mm256_and_si256(ll, lo32));
+}
+// High 32 bits of x*y on 32 bit lanes
+AC_BATCH_AVX2_INLINE __m256i ac_v256_mulhi_epi32(__m256i x, __m256i y)
+{
+	__m256i even = _mm256_srli_epi64(_mm256_mul_epi32(x, y), 32);
+	__m256i odd = _mm256_mul_epi32(_mm256_srli_epi64(x, 32),
+				       _mm256_srli_epi64(y, 32));
+	return _mm256_blend_epi32(even, odd, 0xaa);
+}
+AC_BATCH_AVX2_INLINE __m256i ac_v256_mulhi_epu32(__m256i x, __m256i y)
+{
+	__m256i even = _mm256_srli_epi64(_mm256_mul_epu32(x, y), 32);
+	__m256i odd = _mm256_mul_epu32(_mm256_srli_epi64(x, 32),
+				       _mm256_srli_epi64(y, 32));
+	return _mm256_blend_epi32(even, odd, 0xaa);
+}
+#else
+#define AC_BATCH_SELECT(fun, ...) fun##_scalar(__VA_ARGS__)
+#define AC_BATCH_KERNEL(...)
+#endif
+
+// r[i] = fun(x[i]) for unary operations, encode and decode
+#define AC_BATCH_UNARY_KERNEL(attr, fun, kind, TX, TR)                         \
+	attr void fun##_n_##kind(const TX *x, TR *r, size_t n)                 \
+	{                                                                      \
+		for (size_t i = 0; i < n; i++) {                               \
+			r[i] = fun(x[i]);                                      \
+		}                                                              \
+	}
+#define AC_BATCH_UNARY(fun, TX, TR)                                            \
+	AC_BATCH_KERNEL(AC_BATCH_UNARY_KERNEL(AC_BATCH_AVX2, fun, avx2, TX,    \
+					      TR))                             \
+	AC_BATCH_UNARY_KERNEL(AC_BATCH_SCALAR, fun, scalar, TX, TR)            \
+	AC_INLINE void fun##_n(const TX *x, TR *r, size_t n)                   \
+	{                                                                      \
+		AC_BATCH_SELECT(fun##_n, x, r, n);                             \
+	}
+
+// r[i] = fun(x[i], y[i]) for binary operations
+#define AC_BATCH_BINARY_KERNEL(attr, fun, kind, T)                             \
+	attr void fun##_n_##kind(const T *x, const T *y, T *r, size_t n)       \
+	{                                                                      \
+		for (size_t i = 0; i < n; i++) {                               \
+			r[i] = fun(x[i], y[i]);                                \
+		}                                                              \
+	}
+#define AC_BATCH_BINARY_SELECT(fun, T)                                         \
+	AC_INLINE void fun##_n(const T *x, const T *y, T *r, size_t n)         \
+	{                                                                      \
+		AC_BATCH_SELECT(fun##_n, x, y, r, n);                          \
+	}
+#define AC_BATCH_BINARY(fun, T)                                                \
+	AC_BATCH_KERNEL(AC_BATCH_BINARY_KERNEL(AC_BATCH_AVX2, fun, avx2, T))   \
+	AC_BATCH_BINARY_KERNEL(AC_BATCH_SCALAR, fun, scalar, T)                \
+	AC_BATCH_BINARY_SELECT(fun, T)
+
+// The AVX2 kernel uses the hand-written kernel fun##_v256 of the coding, which returns the number of processed
+// elements. The remaining elements are processed by the scalar operation.
+#define AC_BATCH_BINARY_VEC_KERNEL(fun, T)                                     \
+	AC_BATCH_AVX2 void fun##_n_avx2(const T *x, const T *y, T *r, size_t n) \
+	{                                                                      \
+		for (size_t i = fun##_v256(x, y, r, n); i < n; i++) {          \
+			r[i] = fun(x[i], y[i]);                                \
+		}                                                              \
+	}
+#define AC_BATCH_BINARY_VEC(fun, T)                                            \
+	AC_BATCH_KERNEL(AC_BATCH_BINARY_VEC_KERNEL(fun, T))                    \
+	AC_BATCH_BINARY_KERNEL(AC_BATCH_SCALAR, fun, scalar, T)                \
+	AC_BATCH_BINARY_SELECT(fun, T)
+
+// Returns 1 if fun(val[i], valc[i]) holds for all elements. The loop does not stop at the first fault.
+#define AC_BATCH_CHECK_KERNEL(attr, fun, kind, TV, T)                          \
+	attr void fun##_n_##kind(const TV *val, const T *valc, size_t n,       \
+				 int *ok)                                      \
+	{                                                                      \
+		int r = 1;                                                     \
+		for (size_t i = 0; i < n; i++) {                               \
+			r &= fun(val[i], valc[i]);                             \
+		}                                                              \
+		*ok = r;                                                       \
+	}
+#define AC_BATCH_CHECK_SELECT(fun, TV, T)                                      \
+	AC_INLINE int fun##_n(const TV *val, const T *valc, size_t n)          \
+	{                                                                      \
+		int ok;                                                        \
+		AC_BATCH_SELECT(fun##_n, val, valc, n, &ok);                   \
+		return ok;                                                     \
+	}
+#define AC_BATCH_CHECK(fun, TV, T)                                             \
+	AC_BATCH_KERNEL(AC_BATCH_CHECK_KERNEL(AC_BATCH_AVX2, fun, avx2, TV, T)) \
+	AC_BATCH_CHECK_KERNEL(AC_BATCH_SCALAR, fun, scalar, TV, T)             \
+	AC_BATCH_CHECK_SELECT(fun, TV, T)
+
+// fun##_v256 returns the number of processed elements and stores in ok if all of them are valid
+#define AC_BATCH_CHECK_VEC_KERNEL(fun, TV, T)                                  \
+	AC_BATCH_AVX2 void fun##_n_avx2(const TV *val, const T *valc,          \
+					size_t n, int *ok)                     \
+	{                                                                      \
+		int r;                                                         \
+		for (size_t i = fun##_v256(val, valc, n, &r); i < n; i++) {    \
+			r &= fun(val[i], valc[i]);                             \
+		}                                                              \
+		*ok = r;                                                       \
+	}
+#define AC_BATCH_CHECK_VEC(fun, TV, T)                                         \
+	AC_BATCH_KERNEL(AC_BATCH_CHECK_VEC_KERNEL(fun, TV, T))                 \
+	AC_BATCH_CHECK_KERNEL(AC_BATCH_SCALAR, fun, scalar, TV, T)             \
+	AC_BATCH_CHECK_SELECT(fun, TV, T)
+
+// Batch versions of the full operation set of one coding. sfx is the suffix of the functions (e.g. 32c1),
+// T/UT the encoded types and V/UV the unencoded types.
+#define AC_BATCH_DEFINE_OPS(sfx, T, UT, V, UV)                                 \
+	AC_BATCH_DEFINE_OPS_(sfx, T, UT, V, UV, AC_BATCH_BINARY)
+// As AC_BATCH_DEFINE_OPS, the additions use the hand-written AVX2 kernels add_##sfx##_v256 and u_add_##sfx##_v256
+#define AC_BATCH_DEFINE_OPS_VEC(sfx, T, UT, V, UV)                             \
+	AC_BATCH_DEFINE_OPS_(sfx, T, UT, V, UV, AC_BATCH_BINARY_VEC)
+#define AC_BATCH_DEFINE_OPS_(sfx, T, UT, V, UV, ADD)                           \
+	AC_BATCH_UNARY(encode_##sfx, V, T)                                     \
+	AC_BATCH_UNARY(u_encode_##sfx, UV, UT)                                 \
+	AC_BATCH_UNARY(decode_##sfx, T, V)                                     \
+	AC_BATCH_UNARY(u_decode_##sfx, UT, UV)                                 \
+	ADD(add_##sfx, T)                                                      \
+	ADD(u_add_##sfx, UT)                                                   \
+	AC_BATCH_BINARY(sub_##sfx, T)                                          \
+	AC_BATCH_BINARY(u_sub_##sfx, UT)                                       \
+	AC_BATCH_BINARY(mul_##sfx, T)                                          \
+	AC_BATCH_BINARY(u_mul_##sfx, UT)                                       \
+	AC_BATCH_BINARY(div_##sfx, T)                                          \
+	AC_BATCH_BINARY(u_div_##sfx, UT)                                       \
+	AC_BATCH_BINARY(mod_##sfx, T)                                          \
+	AC_BATCH_BINARY(u_mod_##sfx, UT)                                       \
+	AC_BATCH_BINARY(eq_##sfx, T)                                           \
+	AC_BATCH_BINARY(u_eq_##sfx, UT)                                        \
+	AC_BATCH_BINARY(neq_##sfx, T)                                          \
+	AC_BATCH_BINARY(u_neq_##sfx, UT)                                       \
+	AC_BATCH_BINARY(less_##sfx, T)                                         \
+	AC_BATCH_BINARY(u_less_##sfx, UT)                                      \
+	AC_BATCH_BINARY(grt_##sfx, T)                                          \
+	AC_BATCH_BINARY(u_grt_##sfx, UT)                                       \
+	AC_BATCH_BINARY(leq_##sfx, T)                                          \
+	AC_BATCH_BINARY(u_leq_##sfx, UT)                                       \
+	AC_BATCH_BINARY(geq_##sfx, T)                                          \
+	AC_BATCH_BINARY(u_geq_##sfx, UT)                                       \
+	AC_BATCH_BINARY(shl_##sfx, T)                                          \
+	AC_BATCH_BINARY(u_shl_##sfx, UT)                                       \
+	AC_BATCH_BINARY(u_shr_##sfx, UT)                                       \
+	AC_BATCH_BINARY(land_##sfx, T)                                         \
+	AC_BATCH_BINARY(u_land_##sfx, UT)                                      \
+	AC_BATCH_BINARY(lor_##sfx, T)                                          \
+	AC_BATCH_BINARY(u_lor_##sfx, UT)                                       \
+	AC_BATCH_BINARY(and_##sfx, T)                                          \
+	AC_BATCH_BINARY(u_and_##sfx, UT)                                       \
+	AC_BATCH_BINARY(or_##sfx, T)                                           \
+	AC_BATCH_BINARY(u_or_##sfx, UT)                                        \
+	AC_BATCH_BINARY(xor_##sfx, T)                                          \
+	AC_BATCH_BINARY(u_xor_##sfx, UT)                                       \
+	AC_BATCH_UNARY(neg_##sfx, T, T)                                        \
+	AC_BATCH_UNARY(u_neg_##sfx, UT, UT)
+
+// Batch versions of the check functions. CV/UCV are the types of the reference value.
+#define AC_BATCH_DEFINE_CHECK(sfx, T, UT, CV, UCV)                             \
+	AC_BATCH_CHECK(check_##sfx, CV, T)                                     \
+	AC_BATCH_CHECK(u_check_##sfx, UCV, UT)
+// As AC_BATCH_DEFINE_CHECK with the hand-written AVX2 kernels check_##sfx##_v256 and u_check_##sfx##_v256
+#define AC_BATCH_DEFINE_CHECK_VEC(sfx, T, UT, CV, UCV)                         \
+	AC_BATCH_CHECK_VEC(check_##sfx, CV, T)                                 \
+	AC_BATCH_CHECK_VEC(u_check_##sfx, UCV, UT)
+
+#ifdef __cplusplus
+}
+#endif //__cplusplus
+
+#endif //BATCH_H_
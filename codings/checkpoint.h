@@ -0,0 +1,146 @@
+/**
+ * @copyright: (c) 2022, Institute for Control Engineering of Machine Tools and Manufacturing Units,
+ *             University of Stuttgart
+ *             All rights reserved. Licensed under the Apache License, Version 2.0 (the "License");
+ *             you may not use this file except in compliance with the License.
+ *             You may obtain a copy of the License at
+ *                  http://www.apache.org/licenses/LICENSE-2.0
+ *             Unless required by applicable law or agreed to in writing, software
+ *             distributed under the License is distributed on an "AS IS" BASIS,
+ *             WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *             See the License for the specific language governing permissions and
+ *             limitations under the License.
+ * @author: Marc Fischer <marc.fischer@isw.uni-stuttgart.de>
+ * @description: Deferred check of AN and residue code words. Instead of checking each value, a linear signature
+ *               of all code words of a region is accumulated and checked once at a checkpoint:
+ *               - AN: the sum of the code words is a multiple of A
+ *               - Residue: the sum of the values is congruent to the sum of the checks mod A
+ *               The sum is accumulated modulo 2^n and the carries are counted, so adding a code word costs
+ *               one addition and one compare. The exact sum is only reduced mod A in the verify. A fault is
+ *               detected at the next checkpoint instead of at the faulty value.
+ *               The functions are generated by the codings, e.g. for 32c1:
+ *                   ckpt_32c1_t sig;
+ *                   ckpt_init_32c1(&sig);
+ *                   ckpt_add_32c1(&sig, x_c1);
+ *                   u_ckpt_add_n_32c1(&sig, list_c1, n);
+ *                   ckpt_verify_32c1(&sig); // 1 if valid
+ */
+
+#ifndef CHECKPOINT_H_
+#define CHECKPOINT_H_
+#ifdef __cplusplus
+extern "C" {
+#endif //__cplusplus
+
+#include <stddef.h>
+#include <stdint.h>
+#include "common.h"
+
+// Signature of the summed words of the unsigned type UW. sum + carry*2^n - check is a multiple of A
+#define AC_CKPT_TYPE(sfx, UW)                                                  \
+	typedef struct {                                                       \
+		UW sum;                                                        \
+		int64_t carry;                                                 \
+		int64_t check;                                                 \
+	} ckpt_##sfx##_t;                                                      \
+	AC_INLINE void ckpt_init_##sfx(ckpt_##sfx##_t *sig)                    \
+	{                                                                      \
+		sig->sum = 0;                                                  \
+		sig->carry = 0;                                                \
+		sig->check = 0;                                                \
+	}
+
+// Adds the word w. A negative signed word is 2^n too large as unsigned word, neg removes it again
+#define AC_CKPT_ACC(sig, w, neg, chk)                                          \
+	do {                                                                   \
+		(sig)->sum += (w);                                             \
+		(sig)->carry += (int64_t)((sig)->sum < (w)) - (int64_t)(neg);  \
+		(sig)->check += (int64_t)(chk);                                \
+	} while (0)
+
+// (sum + carry*2^n - check) mod A == 0. mod(x) has to reduce words x < A^2 + 2^(n/2), so the halves of the sum
+// are reduced separately. The counters are reduced with 64 bit divisions, A < 2^63.
+#define AC_CKPT_VERIFY(sfx, UW, A, mod)                                        \
+	AC_INLINE int ckpt_verify_##sfx(const ckpt_##sfx##_t *sig)             \
+	{                                                                      \
+		const int h = 4 * sizeof(UW);                                  \
+		const int64_t a = (int64_t)(A);                                \
+		UW ph = mod((UW)1 << h);                                       \
+		UW pn = mod(ph * ph);                                          \
+		UW s = mod(mod(sig->sum >> h) * ph +                           \
+			   (sig->sum & (((UW)1 << h) - 1)));                   \
+		int64_t k = sig->carry % a;                                    \
+		int64_t c = sig->check % a;                                    \
+		k += a & AC_MASK(int64_t, k < 0);                              \
+		c += a & AC_MASK(int64_t, c < 0);                              \
+		UW r = mod(s + mod((UW)k * pn) + (UW)(a - c));                 \
+		return r == 0;                                                 \
+	}
+
+// Code words of type T/UT are summed directly
+#define AC_CKPT_DEFINE_AN(sfx, T, UT, A, mod)                                  \
+	AC_CKPT_TYPE(sfx, UT)                                                  \
+	AC_INLINE void ckpt_add_##sfx(ckpt_##sfx##_t *sig, T x_c1)             \
+	{                                                                      \
+		AC_CKPT_ACC(sig, (UT)x_c1, x_c1 < 0, 0);                       \
+	}                                                                      \
+	AC_INLINE void u_ckpt_add_##sfx(ckpt_##sfx##_t *sig, UT x_c1)          \
+	{                                                                      \
+		AC_CKPT_ACC(sig, x_c1, 0, 0);                                  \
+	}                                                                      \
+	AC_INLINE void ckpt_add_n_##sfx(ckpt_##sfx##_t *sig, const T *x_c1,    \
+					size_t n)                              \
+	{                                                                      \
+		for (size_t i = 0; i < n; i++) {                               \
+			AC_CKPT_ACC(sig, (UT)x_c1[i], x_c1[i] < 0, 0);         \
+		}                                                              \
+	}                                                                      \
+	AC_INLINE void u_ckpt_add_n_##sfx(ckpt_##sfx##_t *sig,                 \
+					  const UT *x_c1, size_t n)            \
+	{                                                                      \
+		for (size_t i = 0; i < n; i++) {                               \
+			AC_CKPT_ACC(sig, x_c1[i], 0, 0);                       \
+		}                                                              \
+	}                                                                      \
+	AC_CKPT_VERIFY(sfx, UT, A, mod)
+
+// The values of the type V/UV and the checks of the code words T/UT are summed separately
+#define AC_CKPT_DEFINE_RES(sfx, T, UT, UV, A, mod)                             \
+	AC_CKPT_TYPE(sfx, UV)                                                  \
+	AC_INLINE void ckpt_add_##sfx(ckpt_##sfx##_t *sig, T x_c1)             \
+	{                                                                      \
+		AC_CKPT_ACC(sig, (UV)x_c1.val, x_c1.val < 0, x_c1.check);      \
+	}                                                                      \
+	AC_INLINE void u_ckpt_add_##sfx(ckpt_##sfx##_t *sig, UT x_c1)          \
+	{                                                                      \
+		AC_CKPT_ACC(sig, x_c1.val, 0, x_c1.check);                     \
+	}                                                                      \
+	AC_INLINE void ckpt_add_n_##sfx(ckpt_##sfx##_t *sig, const T *x_c1,    \
+					size_t n)                              \
+	{                                                                      \
+		for (size_t i = 0; i < n; i++) {                               \
+			AC_CKPT_ACC(sig, (UV)x_c1[i].val, x_c1[i].val < 0,     \
+				    x_c1[i].check);                            \
+		}                                                              \
+	}                                                                      \
+	AC_INLINE void u_ckpt_add_n_##sfx(ckpt_##sfx##_t *sig,                 \
+					  const UT *x_c1, size_t n)            \
+	{                                                                      \
+		for (size_t i = 0; i < n; i++) {                               \
+			AC_CKPT_ACC(sig, x_c1[i].val, 0, x_c1[i].check);       \
+		}                                                              \
+	}                                                                      \
+	AC_CKPT_VERIFY(sfx, UV, A, mod)
+
+// x mod A with the division of the compiler, for codings without an own reduction
+#define AC_CKPT_DEFINE_MOD(sfx, UW, A)                                         \
+	AC_INLINE UW ckpt_mod_##sfx(UW x)                                      \
+	{                                                                      \
+		return x % (UW)(A);                                            \
+	}
+
+#ifdef __cplusplus
+}
+#endif //__cplusplus
+
+#endif //CHECKPOINT_H_
@@ -38,6 +38,9 @@ extern "C" {
 #endif
 #endif
 
+// All bits set if c is 1, 0 if c is 0. Selects the result of comparisons without a branch: r = A & AC_MASK(T, x < y)
+#define AC_MASK(T, c) ((T)0 - (T)(c))
+
 #ifdef __cplusplus
 }
 #endif //__cplusplus
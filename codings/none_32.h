@@ -20,6 +20,7 @@
 #include <stdint.h>
 #include <stdlib.h>
 #include "common.h"
+#include "batch.h"
 
 #define ENCODING_NAME "NONE_32BIT"
 
@@ -158,20 +159,20 @@ AC_INLINE uint32_t u_shr_32(uint32_t x, uint32_t y)
 
 AC_INLINE int32_t land_32(int32_t x, int32_t y)
 {
-	return x && y;
+	return (x != 0) & (y != 0);
 }
 AC_INLINE uint32_t u_land_32(uint32_t x, uint32_t y)
 {
-	return x && y;
+	return (x != 0) & (y != 0);
 }
 
 AC_INLINE int32_t lor_32(int32_t x, int32_t y)
 {
-	return x || y;
+	return (x | y) != 0;
 }
 AC_INLINE uint32_t u_lor_32(uint32_t x, uint32_t y)
 {
-	return x || y;
+	return (x | y) != 0;
 }
 
 AC_INLINE int32_t and_32(int32_t x, int32_t y)
@@ -210,4 +211,6 @@ AC_INLINE uint32_t u_xor_32(uint32_t x, uint32_t y)
 	return x ^ y;
 }
 
+AC_BATCH_DEFINE_OPS(32, int32_t, uint32_t, int32_t, uint32_t)
+
 #endif //NONE32_H_
\ No newline at end of file
@@ -20,6 +20,7 @@
 #include <stdint.h>
 #include <stdlib.h>
 #include "common.h"
+#include "batch.h"
 
 #define ENCODING_NAME "NONE_64BIT"
 
@@ -158,20 +159,20 @@ AC_INLINE uint64_t u_shr_64(uint64_t x, uint64_t y)
 
 AC_INLINE int64_t land_64(int64_t x, int64_t y)
 {
-	return x && y;
+	return (x != 0) & (y != 0);
 }
 AC_INLINE uint64_t u_land_64(uint64_t x, uint64_t y)
 {
-	return x && y;
+	return (x != 0) & (y != 0);
 }
 
 AC_INLINE int64_t lor_64(int64_t x, int64_t y)
 {
-	return x || y;
+	return (x | y) != 0;
 }
 AC_INLINE uint64_t u_lor_64(uint64_t x, uint64_t y)
 {
-	return x || y;
+	return (x | y) != 0;
 }
 
 AC_INLINE int64_t and_64(int64_t x, int64_t y)
@@ -210,4 +211,6 @@ AC_INLINE uint64_t u_xor_64(uint64_t x, uint64_t y)
 	return x ^ y;
 }
 
+AC_BATCH_DEFINE_OPS(64, int64_t, uint64_t, int64_t, uint64_t)
+
 #endif //NONE64_H_
\ No newline at end of file
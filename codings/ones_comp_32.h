@@ -21,6 +21,7 @@ extern "C" {
 #endif //__cplusplus
 
 #include "common.h"
+#include "batch.h"
 #include "helpers.h"
 #include <stdint.h>
 #include <stdlib.h>
@@ -209,16 +210,16 @@ AC_INLINE uint32c1_t u_shr_32c1(uint32c1_t x_c1, uint32c1_t y_c1)
 
 AC_INLINE int32c1_t land_32c1(int32c1_t x_c1, int32c1_t y_c1)
 {
-	return -(x_c1 + 1 && y_c1 + 1) - 1;
+	return -((x_c1 + 1 != 0) & (y_c1 + 1 != 0)) - 1;
 }
 AC_INLINE uint32c1_t u_land_32c1(uint32c1_t x_c1, uint32c1_t y_c1)
 {
-	return -(x_c1 + 1 && y_c1 + 1) - 1;
+	return -((x_c1 + 1 != 0) & (y_c1 + 1 != 0)) - 1;
 }
 
 AC_INLINE int32c1_t lor_32c1(int32c1_t x_c1, int32c1_t y_c1)
 {
-	return -(x_c1 + 1 || y_c1 + 1) - 1;
+	return -((x_c1 + 1 != 0) | (y_c1 + 1 != 0)) - 1;
 }
 AC_INLINE uint32c1_t u_lor_32c1(uint32c1_t x_c1, uint32c1_t y_c1)
 {
@@ -263,6 +264,9 @@ AC_INLINE uint32c1_t u_xor_32c1(uint32c1_t x_c1, uint32c1_t y_c1)
 	return ~(x_c1 ^ y_c1);
 }
 
+AC_BATCH_DEFINE_OPS(32c1, int32c1_t, uint32c1_t, int32_t, uint32_t)
+AC_BATCH_DEFINE_CHECK(32c1, int32c1_t, uint32c1_t, int32c1_t, uint32c1_t)
+
 #ifdef __cplusplus
 }
 #endif //__cplusplus
@@ -21,6 +21,7 @@ extern "C" {
 #endif //__cplusplus
 
 #include "common.h"
+#include "batch.h"
 #include "helpers.h"
 #include <stdint.h>
 #include <stdlib.h>
@@ -210,16 +211,16 @@ AC_INLINE uint64c1_t u_shr_64c1(uint64c1_t x_c1, uint64c1_t y_c1)
 
 AC_INLINE int64c1_t land_64c1(int64c1_t x_c1, int64c1_t y_c1)
 {
-	return -(x_c1 + 1 && y_c1 + 1) - 1;
+	return -((x_c1 + 1 != 0) & (y_c1 + 1 != 0)) - 1;
 }
 AC_INLINE uint64c1_t u_land_64c1(uint64c1_t x_c1, uint64c1_t y_c1)
 {
-	return -(x_c1 + 1 && y_c1 + 1) - 1;
+	return -((x_c1 + 1 != 0) & (y_c1 + 1 != 0)) - 1;
 }
 
 AC_INLINE int64c1_t lor_64c1(int64c1_t x_c1, int64c1_t y_c1)
 {
-	return -(x_c1 + 1 || y_c1 + 1) - 1;
+	return -((x_c1 + 1 != 0) | (y_c1 + 1 != 0)) - 1;
 }
 AC_INLINE uint64c1_t u_lor_64c1(uint64c1_t x_c1, uint64c1_t y_c1)
 {
@@ -264,6 +265,9 @@ AC_INLINE uint64c1_t u_xor_64c1(uint64c1_t x_c1, uint64c1_t y_c1)
 	return ~(x_c1 ^ y_c1);
 }
 
+AC_BATCH_DEFINE_OPS(64c1, int64c1_t, uint64c1_t, int64_t, uint64_t)
+AC_BATCH_DEFINE_CHECK(64c1, int64c1_t, uint64c1_t, int64c1_t, uint64c1_t)
+
 #ifdef __cplusplus
 }
 #endif //__cplusplus
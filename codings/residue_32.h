@@ -21,6 +21,9 @@ extern "C" {
 #endif //__cplusplus
 
 #include "common.h"
+#include "batch.h"
+#include "residue_soa.h"
+#include "checkpoint.h"
 #include "helpers.h"
 #include <stdint.h>
 #include <stdlib.h>
@@ -269,110 +272,72 @@ AC_INLINE uint32c1_t u_mod_32c1(uint32c1_t x_c1, uint32c1_t y_c1)
 
 AC_INLINE int32c1_t eq_32c1(int32c1_t x_c1, int32c1_t y_c1)
 {
-	return encode_32c1(x_c1.val == y_c1.val && x_c1.check == y_c1.check);
+	return encode_32c1((x_c1.val == y_c1.val) &
+			   (x_c1.check == y_c1.check));
 }
 AC_INLINE uint32c1_t u_eq_32c1(uint32c1_t x_c1, uint32c1_t y_c1)
 {
-	return u_encode_32c1(x_c1.val == y_c1.val && x_c1.check == y_c1.check);
+	return u_encode_32c1((x_c1.val == y_c1.val) &
+			     (x_c1.check == y_c1.check));
 }
 
 AC_INLINE int32c1_t neq_32c1(int32c1_t x_c1, int32c1_t y_c1)
 {
-	return encode_32c1(x_c1.val != y_c1.val && x_c1.check != y_c1.check);
+	return encode_32c1((x_c1.val != y_c1.val) &
+			   (x_c1.check != y_c1.check));
 }
 AC_INLINE uint32c1_t u_neq_32c1(uint32c1_t x_c1, uint32c1_t y_c1)
 {
-	return u_encode_32c1(x_c1.val != y_c1.val && x_c1.check != y_c1.check);
+	return u_encode_32c1((x_c1.val != y_c1.val) &
+			     (x_c1.check != y_c1.check));
 }
 
 AC_INLINE int32c1_t less_32c1(int32c1_t x_c1, int32c1_t y_c1)
 {
 	int32c1_t tmp = sub_32c1(x_c1, y_c1);
-	int32c1_t ret;
-	if (x_c1.val < y_c1.val && tmp.val > x_c1.val) {
-		//uf happend --> less is true
-		ret = encode_32c1(1);
-	} else {
-		//no uf --> less is false
-		ret = encode_32c1(0);
-	}
-	return ret;
+	//uf happend --> less is true
+	return encode_32c1((x_c1.val < y_c1.val) & (tmp.val > x_c1.val));
 }
 AC_INLINE uint32c1_t u_less_32c1(uint32c1_t x_c1, uint32c1_t y_c1)
 {
 	uint32c1_t tmp = u_sub_32c1(x_c1, y_c1);
-	uint32c1_t ret;
-	if (x_c1.val < y_c1.val && tmp.val > x_c1.val) {
-		//uf happend --> less is true
-		ret = u_encode_32c1(1);
-	} else {
-		//no uf --> less is false
-		ret = u_encode_32c1(0);
-	}
-	return ret;
+	//uf happend --> less is true
+	return u_encode_32c1((x_c1.val < y_c1.val) & (tmp.val > x_c1.val));
 }
 
 AC_INLINE int32c1_t grt_32c1(int32c1_t x_c1, int32c1_t y_c1)
 {
-	// return -(x_c1 < y_c1) - 1;
+	return less_32c1(y_c1, x_c1);
 }
 AC_INLINE uint32c1_t u_grt_32c1(uint32c1_t x_c1, uint32c1_t y_c1)
 {
-	// return -(x_c1 < y_c1) - 1;
+	return u_less_32c1(y_c1, x_c1);
 }
 
 AC_INLINE int32c1_t leq_32c1(int32c1_t x_c1, int32c1_t y_c1)
 {
 	int32c1_t tmp = sub_32c1(y_c1, x_c1);
-	int32c1_t ret;
-	if (x_c1.val > y_c1.val && tmp.val > y_c1.val) {
-		//uf happend --> leq is fales
-		ret = encode_32c1(0);
-	} else {
-		//no uf --> leq is true
-		ret = encode_32c1(1);
-	}
-	return ret;
+	//uf happend --> leq is false
+	return encode_32c1(!((x_c1.val > y_c1.val) & (tmp.val > y_c1.val)));
 }
 AC_INLINE uint32c1_t u_leq_32c1(uint32c1_t x_c1, uint32c1_t y_c1)
 {
 	uint32c1_t tmp = u_sub_32c1(y_c1, x_c1);
-	uint32c1_t ret;
-	if (x_c1.val > y_c1.val && tmp.val > y_c1.val) {
-		//uf happend --> leq is fales
-		ret = u_encode_32c1(0);
-	} else {
-		//no uf --> leq is true
-		ret = u_encode_32c1(1);
-	}
-	return ret;
+	//uf happend --> leq is false
+	return u_encode_32c1(!((x_c1.val > y_c1.val) & (tmp.val > y_c1.val)));
 }
 
 AC_INLINE int32c1_t geq_32c1(int32c1_t x_c1, int32c1_t y_c1)
 {
 	int32c1_t tmp = sub_32c1(x_c1, y_c1);
-	int32c1_t ret;
-	if (x_c1.val < y_c1.val && tmp.val > x_c1.val) {
-		//uf happend -->qeq is fales
-		ret = encode_32c1(0);
-	} else {
-		//no uf --> geq is true
-		ret = encode_32c1(1);
-	}
-	return ret;
+	//uf happend --> geq is false
+	return encode_32c1(!((x_c1.val < y_c1.val) & (tmp.val > x_c1.val)));
 }
 AC_INLINE uint32c1_t u_geq_32c1(uint32c1_t x_c1, uint32c1_t y_c1)
 {
 	uint32c1_t tmp = u_sub_32c1(x_c1, y_c1);
-	uint32c1_t ret;
-	if (x_c1.val < y_c1.val && tmp.val > x_c1.val) {
-		//uf happend -->qeq is fales
-		ret = u_encode_32c1(0);
-	} else {
-		//no uf --> geq is true
-		ret = u_encode_32c1(1);
-	}
-	return ret;
+	//uf happend --> geq is false
+	return u_encode_32c1(!((x_c1.val < y_c1.val) & (tmp.val > x_c1.val)));
 }
 
 AC_INLINE int32c1_t shl_32c1(int32c1_t x_c1, int32c1_t y_c1)
@@ -401,34 +366,42 @@ AC_INLINE uint32c1_t u_shr_32c1(uint32c1_t x_c1, uint32c1_t y_c1)
 AC_INLINE int32c1_t land_32c1(int32c1_t x_c1, int32c1_t y_c1)
 {
 	int32c1_t res = mul_32c1(x_c1, y_c1);
-	if (res.val != 0) {
-		res = encode_32c1(1);
-	}
+	//Keep the result of the multiplication if it is 0
+	int32_t m = AC_MASK(int32_t, res.val != 0);
+	int32c1_t one = encode_32c1(1);
+	res.val = (one.val & m) | (res.val & ~m);
+	res.check = (one.check & m) | (res.check & ~m);
 	return res;
 }
 AC_INLINE uint32c1_t u_land_32c1(uint32c1_t x_c1, uint32c1_t y_c1)
 {
 	uint32c1_t res = u_mul_32c1(x_c1, y_c1);
-	if (res.val != 0) {
-		res = u_encode_32c1(1);
-	}
+	//Keep the result of the multiplication if it is 0
+	uint32_t m = AC_MASK(uint32_t, res.val != 0);
+	uint32c1_t one = u_encode_32c1(1);
+	res.val = (one.val & m) | (res.val & ~m);
+	res.check = (one.check & m) | (res.check & ~m);
 	return res;
 }
 
 AC_INLINE int32c1_t lor_32c1(int32c1_t x_c1, int32c1_t y_c1)
 {
 	int32c1_t r_c1 = add_32c1(x_c1, y_c1);
-	if (r_c1.val != 0 || x_c1.val < 0 || y_c1.val < 0) {
-		r_c1 = encode_32c1(1);
-	}
+	int32_t m = AC_MASK(int32_t, (r_c1.val != 0) | (x_c1.val < 0) |
+			    (y_c1.val < 0));
+	int32c1_t one = encode_32c1(1);
+	r_c1.val = (one.val & m) | (r_c1.val & ~m);
+	r_c1.check = (one.check & m) | (r_c1.check & ~m);
 	return r_c1;
 }
 AC_INLINE uint32c1_t u_lor_32c1(uint32c1_t x_c1, uint32c1_t y_c1)
 {
 	uint32c1_t r_c1 = u_add_32c1(x_c1, y_c1);
-	if (r_c1.val != 0 || x_c1.val < 0 || y_c1.val < 0) {
-		r_c1 = u_encode_32c1(1);
-	}
+	uint32_t m = AC_MASK(uint32_t, (r_c1.val != 0) | (x_c1.val < 0) |
+			     (y_c1.val < 0));
+	uint32c1_t one = u_encode_32c1(1);
+	r_c1.val = (one.val & m) | (r_c1.val & ~m);
+	r_c1.check = (one.check & m) | (r_c1.check & ~m);
 	return r_c1;
 }
 
@@ -497,6 +470,143 @@ AC_INLINE uint32c1_t u_xor_32c1(uint32c1_t x_c1, uint32c1_t y_c1)
 	return r_c1;
 }
 
+#ifdef AC_BATCH_HAS_AVX2
+// AVX2 kernels of the batch operations, 4 code words per vector with the value in the even and the check in the
+// odd 32 bit lanes. The divisions by A use the magic number ceil(2^34/18); it has to be recalculated if A changes.
+#define AC_RES_MAGIC32 0x38e38e39
+
+// x % A on 32 bit lanes, identical to the C operator
+AC_BATCH_AVX2_INLINE __m256i ac_v256_mod_32c1(__m256i x)
+{
+	__m256i q = _mm256_sub_epi32(
+		_mm256_srai_epi32(
+			ac_v256_mulhi_epi32(x, _mm256_set1_epi32(AC_RES_MAGIC32)),
+			2),
+		_mm256_srai_epi32(x, 31));
+	return _mm256_sub_epi32(x,
+				_mm256_mullo_epi32(q, _mm256_set1_epi32(A1_32)));
+}
+AC_BATCH_AVX2_INLINE __m256i ac_v256_umod_32c1(__m256i x)
+{
+	__m256i q = _mm256_srli_epi32(
+		ac_v256_mulhi_epu32(x, _mm256_set1_epi32(AC_RES_MAGIC32)), 2);
+	return _mm256_sub_epi32(x,
+				_mm256_mullo_epi32(q, _mm256_set1_epi32(A1_32)));
+}
+
+AC_BATCH_AVX2 size_t add_32c1_v256(const int32c1_t *x, const int32c1_t *y,
+				   int32c1_t *r, size_t n)
+{
+	const __m256i zero = _mm256_setzero_si256();
+	const __m256i a = _mm256_set1_epi32(A1_32);
+	const __m256i corr = _mm256_set1_epi32(AC_RES_OVCORR32);
+	size_t i = 0;
+	for (; i + 4 <= n; i += 4) {
+		__m256i xv = _mm256_loadu_si256((const __m256i *)(x + i));
+		__m256i yv = _mm256_loadu_si256((const __m256i *)(y + i));
+		// value in the even lanes, sum of the checks in the odd lanes
+		__m256i s = _mm256_add_epi32(xv, yv);
+		__m256i rneg = _mm256_cmpgt_epi32(zero, s);
+		__m256i rpos = _mm256_cmpgt_epi32(s, zero);
+		__m256i ovf = _mm256_or_si256(
+			_mm256_and_si256(
+				_mm256_and_si256(_mm256_cmpgt_epi32(xv, zero),
+						 _mm256_cmpgt_epi32(yv, zero)),
+				rneg),
+			_mm256_and_si256(
+				_mm256_and_si256(_mm256_cmpgt_epi32(zero, xv),
+						 _mm256_cmpgt_epi32(zero, yv)),
+				rpos));
+		// move the conditions of the values to the lanes of the checks
+		rneg = _mm256_slli_epi64(rneg, 32);
+		rpos = _mm256_slli_epi64(rpos, 32);
+		ovf = _mm256_slli_epi64(ovf, 32);
+
+		__m256i cneg = ac_v256_mod_32c1(_mm256_sub_epi32(
+			ac_v256_mod_32c1(_mm256_add_epi32(s, corr)), a));
+		__m256i cpos = ac_v256_mod_32c1(_mm256_add_epi32(
+			ac_v256_mod_32c1(_mm256_sub_epi32(s, corr)), a));
+		__m256i cov = _mm256_blendv_epi8(cpos, cneg, rneg);
+
+		__m256i c = ac_v256_mod_32c1(s);
+		c = _mm256_sub_epi32(
+			c, _mm256_and_si256(
+				   a, _mm256_and_si256(
+					      rneg, _mm256_cmpgt_epi32(c, zero))));
+		c = _mm256_add_epi32(
+			c, _mm256_and_si256(
+				   a, _mm256_and_si256(
+					      rpos, _mm256_cmpgt_epi32(zero, c))));
+		c = _mm256_blendv_epi8(c, cov, ovf);
+		_mm256_storeu_si256((__m256i *)(r + i),
+				    _mm256_blend_epi32(s, c, 0xaa));
+	}
+	return i;
+}
+AC_BATCH_AVX2 size_t u_add_32c1_v256(const uint32c1_t *x, const uint32c1_t *y,
+				     uint32c1_t *r, size_t n)
+{
+	const __m256i sign = _mm256_set1_epi32(INT32_MIN);
+	const __m256i corr = _mm256_set1_epi32(AC_RES_OVCORR32);
+	size_t i = 0;
+	for (; i + 4 <= n; i += 4) {
+		__m256i xv = _mm256_loadu_si256((const __m256i *)(x + i));
+		__m256i yv = _mm256_loadu_si256((const __m256i *)(y + i));
+		__m256i s = _mm256_add_epi32(xv, yv);
+		// overflow of the value if s < x
+		__m256i ovf = _mm256_cmpgt_epi32(_mm256_xor_si256(xv, sign),
+						 _mm256_xor_si256(s, sign));
+		ovf = _mm256_slli_epi64(ovf, 32);
+		__m256i c = ac_v256_umod_32c1(
+			_mm256_add_epi32(s, _mm256_and_si256(ovf, corr)));
+		_mm256_storeu_si256((__m256i *)(r + i),
+				    _mm256_blend_epi32(s, c, 0xaa));
+	}
+	return i;
+}
+
+// The check compares the residue of the value in the even lanes with the check in the odd lanes
+AC_BATCH_AVX2 size_t check_32c1_v256(const int32_t *val, const int32c1_t *valc,
+				     size_t n, int *ok)
+{
+	(void)val;
+	int valid = -1;
+	size_t i = 0;
+	for (; i + 4 <= n; i += 4) {
+		__m256i c = _mm256_loadu_si256((const __m256i *)(valc + i));
+		__m256i eq = _mm256_cmpeq_epi32(ac_v256_mod_32c1(c),
+						_mm256_srli_epi64(c, 32));
+		valid &= _mm256_movemask_epi8(eq);
+	}
+	*ok = (valid & 0x0f0f0f0f) == 0x0f0f0f0f;
+	return i;
+}
+AC_BATCH_AVX2 size_t u_check_32c1_v256(const uint32_t *val,
+				       const uint32c1_t *valc, size_t n,
+				       int *ok)
+{
+	(void)val;
+	int valid = -1;
+	size_t i = 0;
+	for (; i + 4 <= n; i += 4) {
+		__m256i c = _mm256_loadu_si256((const __m256i *)(valc + i));
+		__m256i eq = _mm256_cmpeq_epi32(ac_v256_umod_32c1(c),
+						_mm256_srli_epi64(c, 32));
+		valid &= _mm256_movemask_epi8(eq);
+	}
+	*ok = (valid & 0x0f0f0f0f) == 0x0f0f0f0f;
+	return i;
+}
+#endif
+
+AC_BATCH_DEFINE_OPS_VEC(32c1, int32c1_t, uint32c1_t, int32_t, uint32_t)
+AC_BATCH_DEFINE_CHECK_VEC(32c1, int32c1_t, uint32c1_t, int32_t, uint32_t)
+AC_CKPT_DEFINE_MOD(32c1, uint32_t, A1_32)
+AC_CKPT_DEFINE_RES(32c1, int32c1_t, uint32c1_t, uint32_t, A1_32,
+		   ckpt_mod_32c1)
+AC_SOA_DEFINE(32c1, int32c1_soa_t, uint32c1_soa_t, int32c1_t, uint32c1_t, int32_t,
+	      uint32_t, A1_32)
+
 #ifdef __cplusplus
 }
 #endif //__cplusplus
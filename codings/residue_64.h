@@ -21,6 +21,9 @@ extern "C" {
 #endif //__cplusplus
 
 #include "common.h"
+#include "batch.h"
+#include "residue_soa.h"
+#include "checkpoint.h"
 #include "helpers.h"
 #include <stdint.h>
 #include <stdlib.h>
@@ -276,110 +279,72 @@ AC_INLINE uint64c1_t u_mod_64c1(uint64c1_t x_c1, uint64c1_t y_c1)
 
 AC_INLINE int64c1_t eq_64c1(int64c1_t x_c1, int64c1_t y_c1)
 {
-	return encode_64c1(x_c1.val == y_c1.val && x_c1.check == y_c1.check);
+	return encode_64c1((x_c1.val == y_c1.val) &
+			   (x_c1.check == y_c1.check));
 }
 AC_INLINE uint64c1_t u_eq_64c1(uint64c1_t x_c1, uint64c1_t y_c1)
 {
-	return u_encode_64c1(x_c1.val == y_c1.val && x_c1.check == y_c1.check);
+	return u_encode_64c1((x_c1.val == y_c1.val) &
+			     (x_c1.check == y_c1.check));
 }
 
 AC_INLINE int64c1_t neq_64c1(int64c1_t x_c1, int64c1_t y_c1)
 {
-	return encode_64c1(x_c1.val != y_c1.val && x_c1.check != y_c1.check);
+	return encode_64c1((x_c1.val != y_c1.val) &
+			   (x_c1.check != y_c1.check));
 }
 AC_INLINE uint64c1_t u_neq_64c1(uint64c1_t x_c1, uint64c1_t y_c1)
 {
-	return u_encode_64c1(x_c1.val != y_c1.val && x_c1.check != y_c1.check);
+	return u_encode_64c1((x_c1.val != y_c1.val) &
+			     (x_c1.check != y_c1.check));
 }
 
 AC_INLINE int64c1_t less_64c1(int64c1_t x_c1, int64c1_t y_c1)
 {
 	int64c1_t tmp = sub_64c1(x_c1, y_c1);
-	int64c1_t ret;
-	if (x_c1.val < y_c1.val && tmp.val > x_c1.val) {
-		//uf happend --> less is true
-		ret = encode_64c1(1);
-	} else {
-		//no uf --> less is false
-		ret = encode_64c1(0);
-	}
-	return ret;
+	//uf happend --> less is true
+	return encode_64c1((x_c1.val < y_c1.val) & (tmp.val > x_c1.val));
 }
 AC_INLINE uint64c1_t u_less_64c1(uint64c1_t x_c1, uint64c1_t y_c1)
 {
 	uint64c1_t tmp = u_sub_64c1(x_c1, y_c1);
-	uint64c1_t ret;
-	if (x_c1.val < y_c1.val && tmp.val > x_c1.val) {
-		//uf happend --> less is true
-		ret = u_encode_64c1(1);
-	} else {
-		//no uf --> less is false
-		ret = u_encode_64c1(0);
-	}
-	return ret;
+	//uf happend --> less is true
+	return u_encode_64c1((x_c1.val < y_c1.val) & (tmp.val > x_c1.val));
 }
 
 AC_INLINE int64c1_t grt_64c1(int64c1_t x_c1, int64c1_t y_c1)
 {
-	// return -(x_c1 < y_c1) - 1;
+	return less_64c1(y_c1, x_c1);
 }
 AC_INLINE uint64c1_t u_grt_64c1(uint64c1_t x_c1, uint64c1_t y_c1)
 {
-	// return -(x_c1 < y_c1) - 1;
+	return u_less_64c1(y_c1, x_c1);
 }
 
 AC_INLINE int64c1_t leq_64c1(int64c1_t x_c1, int64c1_t y_c1)
 {
 	int64c1_t tmp = sub_64c1(y_c1, x_c1);
-	int64c1_t ret;
-	if (x_c1.val > y_c1.val && tmp.val > y_c1.val) {
-		//uf happend --> leq is fales
-		ret = encode_64c1(0);
-	} else {
-		//no uf --> leq is true
-		ret = encode_64c1(1);
-	}
-	return ret;
+	//uf happend --> leq is false
+	return encode_64c1(!((x_c1.val > y_c1.val) & (tmp.val > y_c1.val)));
 }
 AC_INLINE uint64c1_t u_leq_64c1(uint64c1_t x_c1, uint64c1_t y_c1)
 {
 	uint64c1_t tmp = u_sub_64c1(y_c1, x_c1);
-	uint64c1_t ret;
-	if (x_c1.val > y_c1.val && tmp.val > y_c1.val) {
-		//uf happend --> leq is fales
-		ret = u_encode_64c1(0);
-	} else {
-		//no uf --> leq is true
-		ret = u_encode_64c1(1);
-	}
-	return ret;
+	//uf happend --> leq is false
+	return u_encode_64c1(!((x_c1.val > y_c1.val) & (tmp.val > y_c1.val)));
 }
 
 AC_INLINE int64c1_t geq_64c1(int64c1_t x_c1, int64c1_t y_c1)
 {
 	int64c1_t tmp = sub_64c1(x_c1, y_c1);
-	int64c1_t ret;
-	if (x_c1.val < y_c1.val && tmp.val > x_c1.val) {
-		//uf happend -->qeq is fales
-		ret = encode_64c1(0);
-	} else {
-		//no uf --> geq is true
-		ret = encode_64c1(1);
-	}
-	return ret;
+	//uf happend --> geq is false
+	return encode_64c1(!((x_c1.val < y_c1.val) & (tmp.val > x_c1.val)));
 }
 AC_INLINE uint64c1_t u_geq_64c1(uint64c1_t x_c1, uint64c1_t y_c1)
 {
 	uint64c1_t tmp = u_sub_64c1(x_c1, y_c1);
-	uint64c1_t ret;
-	if (x_c1.val < y_c1.val && tmp.val > x_c1.val) {
-		//uf happend -->qeq is fales
-		ret = u_encode_64c1(0);
-	} else {
-		//no uf --> geq is true
-		ret = u_encode_64c1(1);
-	}
-	return ret;
+	//uf happend --> geq is false
+	return u_encode_64c1(!((x_c1.val < y_c1.val) & (tmp.val > x_c1.val)));
 }
 
 AC_INLINE int64c1_t shl_64c1(int64c1_t x_c1, int64c1_t y_c1)
@@ -408,34 +373,42 @@ AC_INLINE uint64c1_t u_shr_64c1(uint64c1_t x_c1, uint64c1_t y_c1)
 AC_INLINE int64c1_t land_64c1(int64c1_t x_c1, int64c1_t y_c1)
 {
 	int64c1_t res = mul_64c1(x_c1, y_c1);
-	if (res.val != 0) {
-		res = encode_64c1(1);
-	}
+	//Keep the result of the multiplication if it is 0
+	int64_t m = AC_MASK(int64_t, res.val != 0);
+	int64c1_t one = encode_64c1(1);
+	res.val = (one.val & m) | (res.val & ~m);
+	res.check = (one.check & m) | (res.check & ~m);
 	return res;
 }
 AC_INLINE uint64c1_t u_land_64c1(uint64c1_t x_c1, uint64c1_t y_c1)
 {
 	uint64c1_t res = u_mul_64c1(x_c1, y_c1);
-	if (res.val != 0) {
-		res = u_encode_64c1(1);
-	}
+	//Keep the result of the multiplication if it is 0
+	uint64_t m = AC_MASK(uint64_t, res.val != 0);
+	uint64c1_t one = u_encode_64c1(1);
+	res.val = (one.val & m) | (res.val & ~m);
+	res.check = (one.check & m) | (res.check & ~m);
 	return res;
 }
 
 AC_INLINE int64c1_t lor_64c1(int64c1_t x_c1, int64c1_t y_c1)
 {
 	int64c1_t r_c1 = add_64c1(x_c1, y_c1);
-	if (r_c1.val != 0 || x_c1.val < 0 || y_c1.val < 0) {
-		r_c1 = encode_64c1(1);
-	}
+	int64_t m = AC_MASK(int64_t, (r_c1.val != 0) | (x_c1.val < 0) |
+			    (y_c1.val < 0));
+	int64c1_t one = encode_64c1(1);
+	r_c1.val = (one.val & m) | (r_c1.val & ~m);
+	r_c1.check = (one.check & m) | (r_c1.check & ~m);
 	return r_c1;
 }
 AC_INLINE uint64c1_t u_lor_64c1(uint64c1_t x_c1, uint64c1_t y_c1)
 {
 	uint64c1_t r_c1 = u_add_64c1(x_c1, y_c1);
-	if (r_c1.val != 0 || x_c1.val < 0 || y_c1.val < 0) {
-		r_c1 = u_encode_64c1(1);
-	}
+	uint64_t m = AC_MASK(uint64_t, (r_c1.val != 0) | (x_c1.val < 0) |
+			     (y_c1.val < 0));
+	uint64c1_t one = u_encode_64c1(1);
+	r_c1.val = (one.val & m) | (r_c1.val & ~m);
+	r_c1.check = (one.check & m) | (r_c1.check & ~m);
 	return r_c1;
 }
 
@@ -504,6 +477,14 @@ AC_INLINE uint64c1_t u_xor_64c1(uint64c1_t x_c1, uint64c1_t y_c1)
 	return r_c1;
 }
 
+AC_BATCH_DEFINE_OPS(64c1, int64c1_t, uint64c1_t, int64_t, uint64_t)
+AC_BATCH_DEFINE_CHECK(64c1, int64c1_t, uint64c1_t, int64_t, uint64_t)
+AC_CKPT_DEFINE_MOD(64c1, uint64_t, A1_64)
+AC_CKPT_DEFINE_RES(64c1, int64c1_t, uint64c1_t, uint64_t, A1_64,
+		   ckpt_mod_64c1)
+AC_SOA_DEFINE(64c1, int64c1_soa_t, uint64c1_soa_t, int64c1_t, uint64c1_t, int64_t,
+	      uint64_t, A1_64)
+
 #ifdef __cplusplus
 }
 #endif //__cplusplus
@@ -0,0 +1,402 @@
+/**
+ * @copyright: (c) 2022, Institute for Control Engineering of Machine Tools and Manufacturing Units,
+ *             University of Stuttgart
+ *             All rights reserved. Licensed under the Apache License, Version 2.0 (the "License");
+ *             you may not use this file except in compliance with the License.
+ *             You may obtain a copy of the License at
+ *                  http://www.apache.org/licenses/LICENSE-2.0
+ *             Unless required by applicable law or agreed to in writing, software
+ *             distributed under the License is distributed on an "AS IS" BASIS,
+ *             WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *             See the License for the specific language governing permissions and
+ *             limitations under the License.
+ * @author: Marc Fischer <marc.fischer@isw.uni-stuttgart.de>
+ * @description: Provides all primitive functions for encoding one channel with the residue without branches.
+ *               The modulus is a compile time constant, so every % is a multiplication. Overflows are detected
+ *               with __builtin_*_overflow and corrected with masks instead of branches.
+ *               The check is always val % A (sign of val for signed values).
+ */
+
+#ifndef RESBL32_1_H_
+#define RESBL32_1_H_
+#ifdef __cplusplus
+extern "C" {
+#endif //__cplusplus
+
+#include "common.h"
+#include "batch.h"
+#include "residue_soa.h"
+#include "checkpoint.h"
+#include <stdint.h>
+#include <stdlib.h>
+
+#define ENCODING_NAME "RESIDUE_BRANCHLESS_32BIT"
+
+typedef struct {
+	int32_t val;
+	int32_t check;
+} int32c1_t;
+typedef struct {
+	uint32_t val;
+	uint32_t check;
+} uint32c1_t;
+
+// A for encoding floats
+#define AC_RES_A 18
+// 2^32 % A, the check changes by this value on an overflow
+#define AC_RES_T32 ((int32_t)(((uint64_t)1 << 32) % AC_RES_A))
+// Result of an invalid division
+#define AC_RES_INVALID 33
+
+// a if cond else b
+AC_INLINE int32_t res_sel_32c1(int cond, int32_t a, int32_t b)
+{
+	int32_t m = -(int32_t)(cond != 0);
+	return (a & m) | (b & ~m);
+}
+// Reduces c to the check of val: c % A with the sign of val. c has to be congruent to val mod A
+AC_INLINE int32_t res_norm_32c1(int64_t c, int32_t val)
+{
+	int32_t m = (int32_t)(c % AC_RES_A);
+	m += AC_RES_A & -(int32_t)((val >= 0) & (m < 0));
+	m -= AC_RES_A & -(int32_t)((val < 0) & (m > 0));
+	return m;
+}
+
+AC_INLINE int32c1_t encode_32c1(int32_t x)
+{
+	int32c1_t ret;
+	ret.val = x;
+	ret.check = x % AC_RES_A;
+	return ret;
+}
+AC_INLINE uint32c1_t u_encode_32c1(uint32_t x)
+{
+	uint32c1_t ret;
+	ret.val = x;
+	ret.check = x % AC_RES_A;
+	return ret;
+}
+
+AC_INLINE int32_t decode_32c1(int32c1_t x_c1)
+{
+	return x_c1.val;
+}
+AC_INLINE uint32_t u_decode_32c1(uint32c1_t x_c1)
+{
+	return x_c1.val;
+}
+AC_INLINE int check_32c1(int32_t val, int32c1_t valc)
+{
+	return valc.val % AC_RES_A == valc.check;
+}
+AC_INLINE int u_check_32c1(uint32_t val, uint32c1_t valc)
+{
+	return valc.val % AC_RES_A == valc.check;
+}
+
+AC_INLINE int32c1_t add_32c1(int32c1_t x_c1, int32c1_t y_c1)
+{
+	int32c1_t res;
+	int ov = __builtin_add_overflow(x_c1.val, y_c1.val, &res.val);
+	//overflow correction: the sum is res.val+2^32 if res.val<0, res.val-2^32 otherwise
+	int32_t corr = res_sel_32c1(res.val < 0, -AC_RES_T32, AC_RES_T32);
+	res.check = res_norm_32c1(
+		(int64_t)x_c1.check + y_c1.check + (corr & -ov), res.val);
+	return res;
+}
+AC_INLINE uint32c1_t u_add_32c1(uint32c1_t x_c1, uint32c1_t y_c1)
+{
+	uint32c1_t res;
+	uint32_t ov = __builtin_add_overflow(x_c1.val, y_c1.val, &res.val);
+	//overflow correction: -2^32 = A-(2^32 % A) mod A
+	res.check = (x_c1.check + y_c1.check + (AC_RES_A - AC_RES_T32) * ov) %
+		    AC_RES_A;
+	return res;
+}
+
+AC_INLINE int32c1_t sub_32c1(int32c1_t x_c1, int32c1_t y_c1)
+{
+	int32c1_t res;
+	int ov = __builtin_sub_overflow(x_c1.val, y_c1.val, &res.val);
+	//underflow correction: the difference is res.val+2^32 if res.val<0, res.val-2^32 otherwise
+	int32_t corr = res_sel_32c1(res.val < 0, -AC_RES_T32, AC_RES_T32);
+	res.check = res_norm_32c1(
+		(int64_t)x_c1.check - y_c1.check + (corr & -ov), res.val);
+	return res;
+}
+AC_INLINE uint32c1_t u_sub_32c1(uint32c1_t x_c1, uint32c1_t y_c1)
+{
+	uint32c1_t res;
+	uint32_t uf = __builtin_sub_overflow(x_c1.val, y_c1.val, &res.val);
+	//underflow correction: +2^32
+	res.check = (x_c1.check + AC_RES_A - y_c1.check + AC_RES_T32 * uf) %
+		    AC_RES_A;
+	return res;
+}
+
+AC_INLINE uint32c1_t u_mul_32c1(uint32c1_t x_c1, uint32c1_t y_c1)
+{
+	uint32c1_t res;
+	uint64_t p = (uint64_t)x_c1.val * y_c1.val;
+	res.val = (uint32_t)p;
+	//p = res.val + k*2^32, the overflows are corrected by -k*(2^32 % A)
+	uint64_t k = p >> 32;
+	res.check = ((uint64_t)x_c1.check * y_c1.check +
+		     (k % AC_RES_A) * (AC_RES_A - AC_RES_T32)) %
+		    AC_RES_A;
+	return res;
+}
+
+AC_INLINE int32c1_t mul_32c1(int32c1_t x_c1, int32c1_t y_c1)
+{
+	int32c1_t res;
+	int64_t p = (int64_t)x_c1.val * y_c1.val;
+	res.val = (int32_t)p;
+	//p = res.val + k*2^32, the overflows are corrected by -k*(2^32 % A)
+	int64_t k = (p - res.val) / ((int64_t)1 << 32);
+	res.check = res_norm_32c1((int64_t)x_c1.check * y_c1.check -
+					  (k % AC_RES_A) * AC_RES_T32,
+				  res.val);
+	return res;
+}
+
+AC_INLINE int32c1_t div_32c1(int32c1_t x_c1, int32c1_t y_c1)
+{
+	int32c1_t r_c1;
+	r_c1.val = x_c1.val / y_c1.val;
+	int valid = r_c1.val * y_c1.val + x_c1.val % y_c1.val == x_c1.val;
+	r_c1.check = res_sel_32c1(valid, r_c1.val % AC_RES_A, AC_RES_INVALID);
+	return r_c1;
+}
+AC_INLINE uint32c1_t u_div_32c1(uint32c1_t x_c1, uint32c1_t y_c1)
+{
+	uint32c1_t res;
+	res.val = x_c1.val / y_c1.val;
+	res.check = res.val % AC_RES_A;
+	uint32_t rem = (x_c1.val % y_c1.val) % AC_RES_A;
+	//internal check: (x - x%y) % A = (x/y * y) % A
+	uint32_t checkL = (x_c1.check + AC_RES_A - rem) % AC_RES_A;
+	uint32_t checkR = (res.check * y_c1.check) % AC_RES_A;
+	res.check = res_sel_32c1(checkR != checkL, AC_RES_INVALID, res.check);
+	return res;
+}
+
+AC_INLINE int32c1_t mod_32c1(int32c1_t x_c1, int32c1_t y_c1)
+{
+	int32c1_t r_c1;
+	r_c1.val = x_c1.val % y_c1.val;
+	int valid = (x_c1.val / y_c1.val) * y_c1.val + r_c1.val == x_c1.val;
+	r_c1.check = res_sel_32c1(valid, r_c1.val % AC_RES_A, AC_RES_INVALID);
+	return r_c1;
+}
+AC_INLINE uint32c1_t u_mod_32c1(uint32c1_t x_c1, uint32c1_t y_c1)
+{
+	uint32c1_t r_c1;
+	r_c1.val = x_c1.val % y_c1.val;
+	int valid = (x_c1.val / y_c1.val) * y_c1.val + r_c1.val == x_c1.val;
+	r_c1.check = res_sel_32c1(valid, r_c1.val % AC_RES_A, AC_RES_INVALID);
+	return r_c1;
+}
+
+AC_INLINE int32c1_t eq_32c1(int32c1_t x_c1, int32c1_t y_c1)
+{
+	return encode_32c1((x_c1.val == y_c1.val) & (x_c1.check == y_c1.check));
+}
+AC_INLINE uint32c1_t u_eq_32c1(uint32c1_t x_c1, uint32c1_t y_c1)
+{
+	return u_encode_32c1((x_c1.val == y_c1.val) &
+			     (x_c1.check == y_c1.check));
+}
+
+AC_INLINE int32c1_t neq_32c1(int32c1_t x_c1, int32c1_t y_c1)
+{
+	return encode_32c1((x_c1.val != y_c1.val) & (x_c1.check != y_c1.check));
+}
+AC_INLINE uint32c1_t u_neq_32c1(uint32c1_t x_c1, uint32c1_t y_c1)
+{
+	return u_encode_32c1((x_c1.val != y_c1.val) &
+			     (x_c1.check != y_c1.check));
+}
+
+// The comparisons use the flags of the encoded subtraction: x < y iff the sign of x-y differs from the overflow flag
+// These are the true signed and unsigned comparisons. residue_32.h only reports less if x < y and the encoded x-y
+// is larger than x, so there less(1, 5) is false. The codings return different results for the comparisons.
+AC_INLINE int32c1_t less_32c1(int32c1_t x_c1, int32c1_t y_c1)
+{
+	int32_t d;
+	int ov = __builtin_sub_overflow(x_c1.val, y_c1.val, &d);
+	return encode_32c1((d < 0) ^ ov);
+}
+AC_INLINE uint32c1_t u_less_32c1(uint32c1_t x_c1, uint32c1_t y_c1)
+{
+	uint32_t d;
+	return u_encode_32c1(__builtin_sub_overflow(x_c1.val, y_c1.val, &d));
+}
+
+AC_INLINE int32c1_t grt_32c1(int32c1_t x_c1, int32c1_t y_c1)
+{
+	return less_32c1(y_c1, x_c1);
+}
+AC_INLINE uint32c1_t u_grt_32c1(uint32c1_t x_c1, uint32c1_t y_c1)
+{
+	return u_less_32c1(y_c1, x_c1);
+}
+
+AC_INLINE int32c1_t leq_32c1(int32c1_t x_c1, int32c1_t y_c1)
+{
+	int32_t d;
+	int ov = __builtin_sub_overflow(y_c1.val, x_c1.val, &d);
+	return encode_32c1(!((d < 0) ^ ov));
+}
+AC_INLINE uint32c1_t u_leq_32c1(uint32c1_t x_c1, uint32c1_t y_c1)
+{
+	uint32_t d;
+	return u_encode_32c1(!__builtin_sub_overflow(y_c1.val, x_c1.val, &d));
+}
+
+AC_INLINE int32c1_t geq_32c1(int32c1_t x_c1, int32c1_t y_c1)
+{
+	return leq_32c1(y_c1, x_c1);
+}
+AC_INLINE uint32c1_t u_geq_32c1(uint32c1_t x_c1, uint32c1_t y_c1)
+{
+	return u_leq_32c1(y_c1, x_c1);
+}
+
+AC_INLINE int32c1_t shl_32c1(int32c1_t x_c1, int32c1_t y_c1)
+{
+	int32c1_t y = encode_32c1((int32_t)1 << y_c1.val);
+	int32c1_t r_c1 = mul_32c1(x_c1, y);
+	return r_c1; // result already encoded
+}
+AC_INLINE uint32c1_t u_shl_32c1(uint32c1_t x_c1, uint32c1_t y_c1)
+{
+	uint32c1_t y = u_encode_32c1((uint32_t)1 << y_c1.val);
+	uint32c1_t r_c1 = u_mul_32c1(x_c1, y);
+	return r_c1; // result already encoded
+}
+
+// INFO:	The behaviour of the signed right shift depends on the compiler implementation. Therfore this operation is not
+//		supported and is prohibited.
+
+AC_INLINE uint32c1_t u_shr_32c1(uint32c1_t x_c1, uint32c1_t y_c1)
+{
+	uint32c1_t y = u_encode_32c1((uint32_t)1 << y_c1.val);
+	uint32c1_t r_c1 = u_div_32c1(x_c1, y);
+	return r_c1;
+}
+
+AC_INLINE int32c1_t land_32c1(int32c1_t x_c1, int32c1_t y_c1)
+{
+	int32c1_t res = mul_32c1(x_c1, y_c1);
+	int t = res.val != 0;
+	res.val = res_sel_32c1(t, 1, res.val);
+	res.check = res_sel_32c1(t, 1, res.check);
+	return res;
+}
+AC_INLINE uint32c1_t u_land_32c1(uint32c1_t x_c1, uint32c1_t y_c1)
+{
+	uint32c1_t res = u_mul_32c1(x_c1, y_c1);
+	int t = res.val != 0;
+	res.val = res_sel_32c1(t, 1, res.val);
+	res.check = res_sel_32c1(t, 1, res.check);
+	return res;
+}
+
+AC_INLINE int32c1_t lor_32c1(int32c1_t x_c1, int32c1_t y_c1)
+{
+	int32c1_t r_c1 = add_32c1(x_c1, y_c1);
+	//Force true if one value is negative. For x=-n and y=n the addition is 0 but the result is true
+	int t = (r_c1.val != 0) | (x_c1.val < 0) | (y_c1.val < 0);
+	r_c1.val = res_sel_32c1(t, 1, r_c1.val);
+	r_c1.check = res_sel_32c1(t, 1, r_c1.check);
+	return r_c1;
+}
+AC_INLINE uint32c1_t u_lor_32c1(uint32c1_t x_c1, uint32c1_t y_c1)
+{
+	uint32c1_t r_c1 = u_add_32c1(x_c1, y_c1);
+	//Force true on an overflow, as it can lead to a 0
+	int t = (r_c1.val != 0) | (r_c1.val < x_c1.val);
+	r_c1.val = res_sel_32c1(t, 1, r_c1.val);
+	r_c1.check = res_sel_32c1(t, 1, r_c1.check);
+	return r_c1;
+}
+
+AC_INLINE int32c1_t and_32c1(int32c1_t x_c1, int32c1_t y_c1)
+{
+	int32c1_t res;
+	res.val = x_c1.val & y_c1.val;
+	res.check = (-1 - ((-1 - x_c1.val) | (-1 - y_c1.val))) % AC_RES_A;
+	return res;
+}
+AC_INLINE uint32c1_t u_and_32c1(uint32c1_t x_c1, uint32c1_t y_c1)
+{
+	uint32c1_t res;
+	res.val = x_c1.val & y_c1.val;
+	res.check = (0xFFFFFFFF -
+		     ((0xFFFFFFFF - x_c1.val) | (0xFFFFFFFF - y_c1.val))) %
+		    AC_RES_A;
+	return res;
+}
+
+AC_INLINE int32c1_t or_32c1(int32c1_t x_c1, int32c1_t y_c1)
+{
+	int32c1_t res;
+	res.val = x_c1.val | y_c1.val;
+	res.check = (-1 - ((-1 - x_c1.val) & (-1 - y_c1.val))) % AC_RES_A;
+	return res;
+}
+AC_INLINE uint32c1_t u_or_32c1(uint32c1_t x_c1, uint32c1_t y_c1)
+{
+	uint32c1_t res;
+	res.val = x_c1.val | y_c1.val;
+	res.check = (0xFFFFFFFF -
+		     ((0xFFFFFFFF - x_c1.val) & (0xFFFFFFFF - y_c1.val))) %
+		    AC_RES_A;
+	return res;
+}
+
+AC_INLINE int32c1_t neg_32c1(int32c1_t x_c1)
+{
+	int32c1_t res;
+	res.val = ~x_c1.val;
+	res.check = (-1 - x_c1.val) % AC_RES_A;
+	return res;
+}
+AC_INLINE uint32c1_t u_neg_32c1(uint32c1_t x_c1)
+{
+	uint32c1_t res;
+	res.val = ~x_c1.val;
+	res.check = (0xFFFFFFFF - x_c1.val) % AC_RES_A;
+	return res;
+}
+
+AC_INLINE int32c1_t xor_32c1(int32c1_t x_c1, int32c1_t y_c1)
+{
+	int32c1_t p1 = and_32c1(neg_32c1(x_c1), y_c1);
+	int32c1_t p2 = and_32c1(x_c1, neg_32c1(y_c1));
+	int32c1_t r_c1 = or_32c1(p1, p2);
+	return r_c1;
+}
+AC_INLINE uint32c1_t u_xor_32c1(uint32c1_t x_c1, uint32c1_t y_c1)
+{
+	uint32c1_t p1 = u_and_32c1(u_neg_32c1(x_c1), y_c1);
+	uint32c1_t p2 = u_and_32c1(x_c1, u_neg_32c1(y_c1));
+	uint32c1_t r_c1 = u_or_32c1(p1, p2);
+	return r_c1;
+}
+
+AC_BATCH_DEFINE_OPS(32c1, int32c1_t, uint32c1_t, int32_t, uint32_t)
+AC_BATCH_DEFINE_CHECK(32c1, int32c1_t, uint32c1_t, int32_t, uint32_t)
+AC_CKPT_DEFINE_MOD(32c1, uint32_t, AC_RES_A)
+AC_CKPT_DEFINE_RES(32c1, int32c1_t, uint32c1_t, uint32_t, AC_RES_A,
+		   ckpt_mod_32c1)
+AC_SOA_DEFINE(32c1, int32c1_soa_t, uint32c1_soa_t, int32c1_t, uint32c1_t, int32_t,
+	      uint32_t, AC_RES_A)
+
+#ifdef __cplusplus
+}
+#endif //__cplusplus
+
+#endif // RESBL32_1_H_
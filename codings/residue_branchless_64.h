@@ -0,0 +1,402 @@
+/**
+ * @copyright: (c) 2022, Institute for Control Engineering of Machine Tools and Manufacturing Units,
+ *             University of Stuttgart
+ *             All rights reserved. Licensed under the Apache License, Version 2.0 (the "License");
+ *             you may not use this file except in compliance with the License.
+ *             You may obtain a copy of the License at
+ *                  http://www.apache.org/licenses/LICENSE-2.0
+ *             Unless required by applicable law or agreed to in writing, software
+ *             distributed under the License is distributed on an "AS IS" BASIS,
+ *             WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *             See the License for the specific language governing permissions and
+ *             limitations under the License.
+ * @author: Marc Fischer <marc.fischer@isw.uni-stuttgart.de>
+ * @description: Provides all primitive functions for encoding one channel with the residue without branches.
+ *               The modulus is a compile time constant, so every % is a multiplication. Overflows are detected
+ *               with __builtin_*_overflow and corrected with masks instead of branches.
+ *               The check is always val % A (sign of val for signed values).
+ */
+
+#ifndef RESBL64_1_H_
+#define RESBL64_1_H_
+#ifdef __cplusplus
+extern "C" {
+#endif //__cplusplus
+
+#include "common.h"
+#include "batch.h"
+#include "residue_soa.h"
+#include "checkpoint.h"
+#include <stdint.h>
+#include <stdlib.h>
+
+#define ENCODING_NAME "RESIDUE_BRANCHLESS_64BIT"
+
+typedef struct {
+	int64_t val;
+	int64_t check;
+} int64c1_t;
+typedef struct {
+	uint64_t val;
+	uint64_t check;
+} uint64c1_t;
+
+// A for encoding floats
+#define AC_RES_A 18
+// 2^64 % A, the check changes by this value on an overflow
+#define AC_RES_T64 ((int64_t)(((__uint128_t)1 << 64) % AC_RES_A))
+// Result of an invalid division
+#define AC_RES_INVALID 33
+
+// a if cond else b
+AC_INLINE int64_t res_sel_64c1(int cond, int64_t a, int64_t b)
+{
+	int64_t m = -(int64_t)(cond != 0);
+	return (a & m) | (b & ~m);
+}
+// Reduces c to the check of val: c % A with the sign of val. c has to be congruent to val mod A
+AC_INLINE int64_t res_norm_64c1(int64_t c, int64_t val)
+{
+	int64_t m = (int64_t)(c % AC_RES_A);
+	m += AC_RES_A & -(int64_t)((val >= 0) & (m < 0));
+	m -= AC_RES_A & -(int64_t)((val < 0) & (m > 0));
+	return m;
+}
+
+AC_INLINE int64c1_t encode_64c1(int64_t x)
+{
+	int64c1_t ret;
+	ret.val = x;
+	ret.check = x % AC_RES_A;
+	return ret;
+}
+AC_INLINE uint64c1_t u_encode_64c1(uint64_t x)
+{
+	uint64c1_t ret;
+	ret.val = x;
+	ret.check = x % AC_RES_A;
+	return ret;
+}
+
+AC_INLINE int64_t decode_64c1(int64c1_t x_c1)
+{
+	return x_c1.val;
+}
+AC_INLINE uint64_t u_decode_64c1(uint64c1_t x_c1)
+{
+	return x_c1.val;
+}
+AC_INLINE int check_64c1(int64_t val, int64c1_t valc)
+{
+	return valc.val % AC_RES_A == valc.check;
+}
+AC_INLINE int u_check_64c1(uint64_t val, uint64c1_t valc)
+{
+	return valc.val % AC_RES_A == valc.check;
+}
+
+AC_INLINE int64c1_t add_64c1(int64c1_t x_c1, int64c1_t y_c1)
+{
+	int64c1_t res;
+	int ov = __builtin_add_overflow(x_c1.val, y_c1.val, &res.val);
+	//overflow correction: the sum is res.val+2^64 if res.val<0, res.val-2^64 otherwise
+	int64_t corr = res_sel_64c1(res.val < 0, -AC_RES_T64, AC_RES_T64);
+	res.check = res_norm_64c1(
+		x_c1.check + y_c1.check + (corr & -ov), res.val);
+	return res;
+}
+AC_INLINE uint64c1_t u_add_64c1(uint64c1_t x_c1, uint64c1_t y_c1)
+{
+	uint64c1_t res;
+	uint64_t ov = __builtin_add_overflow(x_c1.val, y_c1.val, &res.val);
+	//overflow correction: -2^64 = A-(2^64 % A) mod A
+	res.check = (x_c1.check + y_c1.check + (AC_RES_A - AC_RES_T64) * ov) %
+		    AC_RES_A;
+	return res;
+}
+
+AC_INLINE int64c1_t sub_64c1(int64c1_t x_c1, int64c1_t y_c1)
+{
+	int64c1_t res;
+	int ov = __builtin_sub_overflow(x_c1.val, y_c1.val, &res.val);
+	//underflow correction: the difference is res.val+2^64 if res.val<0, res.val-2^64 otherwise
+	int64_t corr = res_sel_64c1(res.val < 0, -AC_RES_T64, AC_RES_T64);
+	res.check = res_norm_64c1(
+		x_c1.check - y_c1.check + (corr & -ov), res.val);
+	return res;
+}
+AC_INLINE uint64c1_t u_sub_64c1(uint64c1_t x_c1, uint64c1_t y_c1)
+{
+	uint64c1_t res;
+	uint64_t uf = __builtin_sub_overflow(x_c1.val, y_c1.val, &res.val);
+	//underflow correction: +2^64
+	res.check = (x_c1.check + AC_RES_A - y_c1.check + AC_RES_T64 * uf) %
+		    AC_RES_A;
+	return res;
+}
+
+AC_INLINE uint64c1_t u_mul_64c1(uint64c1_t x_c1, uint64c1_t y_c1)
+{
+	uint64c1_t res;
+	__uint128_t p = (__uint128_t)x_c1.val * y_c1.val;
+	res.val = (uint64_t)p;
+	//p = res.val + k*2^64, the overflows are corrected by -k*(2^64 % A)
+	uint64_t k = (uint64_t)(p >> 64);
+	res.check = (x_c1.check * y_c1.check +
+		     (k % AC_RES_A) * (AC_RES_A - AC_RES_T64)) %
+		    AC_RES_A;
+	return res;
+}
+
+AC_INLINE int64c1_t mul_64c1(int64c1_t x_c1, int64c1_t y_c1)
+{
+	int64c1_t res;
+	__int128_t p = (__int128_t)x_c1.val * y_c1.val;
+	res.val = (int64_t)p;
+	//p = res.val + k*2^64, the overflows are corrected by -k*(2^64 % A)
+	int64_t k = (int64_t)((p - res.val) >> 64);
+	res.check = res_norm_64c1(x_c1.check * y_c1.check -
+					  (k % AC_RES_A) * AC_RES_T64,
+				  res.val);
+	return res;
+}
+
+AC_INLINE int64c1_t div_64c1(int64c1_t x_c1, int64c1_t y_c1)
+{
+	int64c1_t r_c1;
+	r_c1.val = x_c1.val / y_c1.val;
+	int valid = r_c1.val * y_c1.val + x_c1.val % y_c1.val == x_c1.val;
+	r_c1.check = res_sel_64c1(valid, r_c1.val % AC_RES_A, AC_RES_INVALID);
+	return r_c1;
+}
+AC_INLINE uint64c1_t u_div_64c1(uint64c1_t x_c1, uint64c1_t y_c1)
+{
+	uint64c1_t res;
+	res.val = x_c1.val / y_c1.val;
+	res.check = res.val % AC_RES_A;
+	uint64_t rem = (x_c1.val % y_c1.val) % AC_RES_A;
+	//internal check: (x - x%y) % A = (x/y * y) % A
+	uint64_t checkL = (x_c1.check + AC_RES_A - rem) % AC_RES_A;
+	uint64_t checkR = (res.check * y_c1.check) % AC_RES_A;
+	res.check = res_sel_64c1(checkR != checkL, AC_RES_INVALID, res.check);
+	return res;
+}
+
+AC_INLINE int64c1_t mod_64c1(int64c1_t x_c1, int64c1_t y_c1)
+{
+	int64c1_t r_c1;
+	r_c1.val = x_c1.val % y_c1.val;
+	int valid = (x_c1.val / y_c1.val) * y_c1.val + r_c1.val == x_c1.val;
+	r_c1.check = res_sel_64c1(valid, r_c1.val % AC_RES_A, AC_RES_INVALID);
+	return r_c1;
+}
+AC_INLINE uint64c1_t u_mod_64c1(uint64c1_t x_c1, uint64c1_t y_c1)
+{
+	uint64c1_t r_c1;
+	r_c1.val = x_c1.val % y_c1.val;
+	int valid = (x_c1.val / y_c1.val) * y_c1.val + r_c1.val == x_c1.val;
+	r_c1.check = res_sel_64c1(valid, r_c1.val % AC_RES_A, AC_RES_INVALID);
+	return r_c1;
+}
+
+AC_INLINE int64c1_t eq_64c1(int64c1_t x_c1, int64c1_t y_c1)
+{
+	return encode_64c1((x_c1.val == y_c1.val) & (x_c1.check == y_c1.check));
+}
+AC_INLINE uint64c1_t u_eq_64c1(uint64c1_t x_c1, uint64c1_t y_c1)
+{
+	return u_encode_64c1((x_c1.val == y_c1.val) &
+			     (x_c1.check == y_c1.check));
+}
+
+AC_INLINE int64c1_t neq_64c1(int64c1_t x_c1, int64c1_t y_c1)
+{
+	return encode_64c1((x_c1.val != y_c1.val) & (x_c1.check != y_c1.check));
+}
+AC_INLINE uint64c1_t u_neq_64c1(uint64c1_t x_c1, uint64c1_t y_c1)
+{
+	return u_encode_64c1((x_c1.val != y_c1.val) &
+			     (x_c1.check != y_c1.check));
+}
+
+// The comparisons use the flags of the encoded subtraction: x < y iff the sign of x-y differs from the overflow flag
+// These are the true signed and unsigned comparisons. residue_64.h only reports less if x < y and the encoded x-y
+// is larger than x, so there less(1, 5) is false. The codings return different results for the comparisons.
+AC_INLINE int64c1_t less_64c1(int64c1_t x_c1, int64c1_t y_c1)
+{
+	int64_t d;
+	int ov = __builtin_sub_overflow(x_c1.val, y_c1.val, &d);
+	return encode_64c1((d < 0) ^ ov);
+}
+AC_INLINE uint64c1_t u_less_64c1(uint64c1_t x_c1, uint64c1_t y_c1)
+{
+	uint64_t d;
+	return u_encode_64c1(__builtin_sub_overflow(x_c1.val, y_c1.val, &d));
+}
+
+AC_INLINE int64c1_t grt_64c1(int64c1_t x_c1, int64c1_t y_c1)
+{
+	return less_64c1(y_c1, x_c1);
+}
+AC_INLINE uint64c1_t u_grt_64c1(uint64c1_t x_c1, uint64c1_t y_c1)
+{
+	return u_less_64c1(y_c1, x_c1);
+}
+
+AC_INLINE int64c1_t leq_64c1(int64c1_t x_c1, int64c1_t y_c1)
+{
+	int64_t d;
+	int ov = __builtin_sub_overflow(y_c1.val, x_c1.val, &d);
+	return encode_64c1(!((d < 0) ^ ov));
+}
+AC_INLINE uint64c1_t u_leq_64c1(uint64c1_t x_c1, uint64c1_t y_c1)
+{
+	uint64_t d;
+	return u_encode_64c1(!__builtin_sub_overflow(y_c1.val, x_c1.val, &d));
+}
+
+AC_INLINE int64c1_t geq_64c1(int64c1_t x_c1, int64c1_t y_c1)
+{
+	return leq_64c1(y_c1, x_c1);
+}
+AC_INLINE uint64c1_t u_geq_64c1(uint64c1_t x_c1, uint64c1_t y_c1)
+{
+	return u_leq_64c1(y_c1, x_c1);
+}
+
+AC_INLINE int64c1_t shl_64c1(int64c1_t x_c1, int64c1_t y_c1)
+{
+	int64c1_t y = encode_64c1((int64_t)1 << y_c1.val);
+	int64c1_t r_c1 = mul_64c1(x_c1, y);
+	return r_c1; // result already encoded
+}
+AC_INLINE uint64c1_t u_shl_64c1(uint64c1_t x_c1, uint64c1_t y_c1)
+{
+	uint64c1_t y = u_encode_64c1((uint64_t)1 << y_c1.val);
+	uint64c1_t r_c1 = u_mul_64c1(x_c1, y);
+	return r_c1; // result already encoded
+}
+
+// INFO:	The behaviour of the signed right shift depends on the compiler implementation. Therfore this operation is not
+//		supported and is prohibited.
+
+AC_INLINE uint64c1_t u_shr_64c1(uint64c1_t x_c1, uint64c1_t y_c1)
+{
+	uint64c1_t y = u_encode_64c1((uint64_t)1 << y_c1.val);
+	uint64c1_t r_c1 = u_div_64c1(x_c1, y);
+	return r_c1;
+}
+
+AC_INLINE int64c1_t land_64c1(int64c1_t x_c1, int64c1_t y_c1)
+{
+	int64c1_t res = mul_64c1(x_c1, y_c1);
+	int t = res.val != 0;
+	res.val = res_sel_64c1(t, 1, res.val);
+	res.check = res_sel_64c1(t, 1, res.check);
+	return res;
+}
+AC_INLINE uint64c1_t u_land_64c1(uint64c1_t x_c1, uint64c1_t y_c1)
+{
+	uint64c1_t res = u_mul_64c1(x_c1, y_c1);
+	int t = res.val != 0;
+	res.val = res_sel_64c1(t, 1, res.val);
+	res.check = res_sel_64c1(t, 1, res.check);
+	return res;
+}
+
+AC_INLINE int64c1_t lor_64c1(int64c1_t x_c1, int64c1_t y_c1)
+{
+	int64c1_t r_c1 = add_64c1(x_c1, y_c1);
+	//Force true if one value is negative. For x=-n and y=n the addition is 0 but the result is true
+	int t = (r_c1.val != 0) | (x_c1.val < 0) | (y_c1.val < 0);
+	r_c1.val = res_sel_64c1(t, 1, r_c1.val);
+	r_c1.check = res_sel_64c1(t, 1, r_c1.check);
+	return r_c1;
+}
+AC_INLINE uint64c1_t u_lor_64c1(uint64c1_t x_c1, uint64c1_t y_c1)
+{
+	uint64c1_t r_c1 = u_add_64c1(x_c1, y_c1);
+	//Force true on an overflow, as it can lead to a 0
+	int t = (r_c1.val != 0) | (r_c1.val < x_c1.val);
+	r_c1.val = res_sel_64c1(t, 1, r_c1.val);
+	r_c1.check = res_sel_64c1(t, 1, r_c1.check);
+	return r_c1;
+}
+
+AC_INLINE int64c1_t and_64c1(int64c1_t x_c1, int64c1_t y_c1)
+{
+	int64c1_t res;
+	res.val = x_c1.val & y_c1.val;
+	res.check = (-1 - ((-1 - x_c1.val) | (-1 - y_c1.val))) % AC_RES_A;
+	return res;
+}
+AC_INLINE uint64c1_t u_and_64c1(uint64c1_t x_c1, uint64c1_t y_c1)
+{
+	uint64c1_t res;
+	res.val = x_c1.val & y_c1.val;
+	res.check = (0xFFFFFFFFFFFFFFFF - ((0xFFFFFFFFFFFFFFFF - x_c1.val) |
+					   (0xFFFFFFFFFFFFFFFF - y_c1.val))) %
+		    AC_RES_A;
+	return res;
+}
+
+AC_INLINE int64c1_t or_64c1(int64c1_t x_c1, int64c1_t y_c1)
+{
+	int64c1_t res;
+	res.val = x_c1.val | y_c1.val;
+	res.check = (-1 - ((-1 - x_c1.val) & (-1 - y_c1.val))) % AC_RES_A;
+	return res;
+}
+AC_INLINE uint64c1_t u_or_64c1(uint64c1_t x_c1, uint64c1_t y_c1)
+{
+	uint64c1_t res;
+	res.val = x_c1.val | y_c1.val;
+	res.check = (0xFFFFFFFFFFFFFFFF - ((0xFFFFFFFFFFFFFFFF - x_c1.val) &
+					   (0xFFFFFFFFFFFFFFFF - y_c1.val))) %
+		    AC_RES_A;
+	return res;
+}
+
+AC_INLINE int64c1_t neg_64c1(int64c1_t x_c1)
+{
+	int64c1_t res;
+	res.val = ~x_c1.val;
+	res.check = (-1 - x_c1.val) % AC_RES_A;
+	return res;
+}
+AC_INLINE uint64c1_t u_neg_64c1(uint64c1_t x_c1)
+{
+	uint64c1_t res;
+	res.val = ~x_c1.val;
+	res.check = (0xFFFFFFFFFFFFFFFF - x_c1.val) % AC_RES_A;
+	return res;
+}
+
+AC_INLINE int64c1_t xor_64c1(int64c1_t x_c1, int64c1_t y_c1)
+{
+	int64c1_t p1 = and_64c1(neg_64c1(x_c1), y_c1);
+	int64c1_t p2 = and_64c1(x_c1, neg_64c1(y_c1));
+	int64c1_t r_c1 = or_64c1(p1, p2);
+	return r_c1;
+}
+AC_INLINE uint64c1_t u_xor_64c1(uint64c1_t x_c1, uint64c1_t y_c1)
+{
+	uint64c1_t p1 = u_and_64c1(u_neg_64c1(x_c1), y_c1);
+	uint64c1_t p2 = u_and_64c1(x_c1, u_neg_64c1(y_c1));
+	uint64c1_t r_c1 = u_or_64c1(p1, p2);
+	return r_c1;
+}
+
+AC_BATCH_DEFINE_OPS(64c1, int64c1_t, uint64c1_t, int64_t, uint64_t)
+AC_BATCH_DEFINE_CHECK(64c1, int64c1_t, uint64c1_t, int64_t, uint64_t)
+AC_CKPT_DEFINE_MOD(64c1, uint64_t, AC_RES_A)
+AC_CKPT_DEFINE_RES(64c1, int64c1_t, uint64c1_t, uint64_t, AC_RES_A,
+		   ckpt_mod_64c1)
+AC_SOA_DEFINE(64c1, int64c1_soa_t, uint64c1_soa_t, int64c1_t, uint64c1_t, int64_t,
+	      uint64_t, AC_RES_A)
+
+#ifdef __cplusplus
+}
+#endif //__cplusplus
+
+#endif // RESBL64_1_H_
@@ -0,0 +1,243 @@
+/**
+ * @copyright: (c) 2022, Institute for Control Engineering of Machine Tools and Manufacturing Units,
+ *             University of Stuttgart
+ *             All rights reserved. Licensed under the Apache License, Version 2.0 (the "License");
+ *             you may not use this file except in compliance with the License.
+ *             You may obtain a copy of the License at
+ *                  http://www.apache.org/licenses/LICENSE-2.0
+ *             Unless required by applicable law or agreed to in writing, software
+ *             distributed under the License is distributed on an "AS IS" BASIS,
+ *             WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *             See the License for the specific language governing permissions and
+ *             limitations under the License.
+ * @author: Marc Fischer <marc.fischer@isw.uni-stuttgart.de>
+ * @description: Generates struct-of-arrays containers for the residue coding.
+ *               The values are stored in one dense array and the checks in a packed 8 bit array, so an encoded
+ *               array of n 32 bit values needs 5n bytes instead of 8n. The batch operations stream both lanes
+ *               and apply the scalar operation of the coding, so the results equal the scalar operations.
+ *               The check lanes hold checks in [-128, 127] (signed) or [0, 255] (unsigned). Checks outside of
+ *               this range are saturated, which keeps them invalid as A is smaller.
+ */
+
+#ifndef RESIDUE_SOA_H_
+#define RESIDUE_SOA_H_
+#ifdef __cplusplus
+extern "C" {
+#endif //__cplusplus
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include "common.h"
+#include "batch.h"
+
+#define AC_SOA_RESIDUE 1
+
+AC_INLINE int8_t soa_pack_check(int64_t c)
+{
+	c = c < INT8_MIN ? INT8_MIN : c;
+	return (int8_t)(c > INT8_MAX ? INT8_MAX : c);
+}
+AC_INLINE uint8_t u_soa_pack_check(uint64_t c)
+{
+	return (uint8_t)(c > UINT8_MAX ? UINT8_MAX : c);
+}
+
+// Container type S with the value type V and the check lane type C
+#define AC_SOA_TYPE(S, V, C)                                                   \
+	typedef struct {                                                       \
+		V *val;                                                        \
+		C *check;                                                      \
+		size_t n;                                                      \
+	} S;
+
+// Allocation, element access and conversion from/to the interleaved type T. pfx is empty or u_.
+#define AC_SOA_ACCESS(pfx, sfx, S, T, V, C)                                    \
+	AC_INLINE S pfx##soa_alloc_##sfx(size_t n)                             \
+	{                                                                      \
+		S s;                                                           \
+		s.val = (V *)malloc(sizeof(V) * n);                            \
+		s.check = (C *)malloc(sizeof(C) * n);                          \
+		s.n = (s.val && s.check) ? n : 0;                              \
+		return s;                                                      \
+	}                                                                      \
+	AC_INLINE void pfx##soa_free_##sfx(S *s)                               \
+	{                                                                      \
+		free(s->val);                                                  \
+		free(s->check);                                                \
+		s->val = NULL;                                                 \
+		s->check = NULL;                                               \
+		s->n = 0;                                                      \
+	}                                                                      \
+	AC_INLINE T pfx##soa_get_##sfx(const S *s, size_t i)                   \
+	{                                                                      \
+		T r;                                                           \
+		r.val = s->val[i];                                             \
+		r.check = s->check[i];                                         \
+		return r;                                                      \
+	}                                                                      \
+	AC_INLINE void pfx##soa_set_##sfx(S *s, size_t i, T x)                 \
+	{                                                                      \
+		s->val[i] = x.val;                                             \
+		s->check[i] = pfx##soa_pack_check(x.check);                    \
+	}
+
+// r = encode(x) for x[0..r->n)
+#define AC_SOA_ENCODE_KERNEL(attr, fun, kind, S, V)                            \
+	attr void fun##_soa_##kind(const V *x, S *r)                           \
+	{                                                                      \
+		V *rv = r->val;                                                \
+		__typeof__(r->check) rc = r->check;                            \
+		for (size_t i = 0; i < r->n; i++) {                            \
+			__typeof__(fun(x[i])) e = fun(x[i]);                   \
+			rv[i] = e.val;                                         \
+			rc[i] = e.check;                                       \
+		}                                                              \
+	}
+#define AC_SOA_ENCODE(fun, S, V)                                               \
+	AC_BATCH_KERNEL(AC_SOA_ENCODE_KERNEL(AC_BATCH_AVX2, fun, avx2, S, V))  \
+	AC_SOA_ENCODE_KERNEL(AC_BATCH_SCALAR, fun, scalar, S, V)               \
+	AC_INLINE void fun##_soa(const V *x, S *r)                             \
+	{                                                                      \
+		AC_BATCH_SELECT(fun##_soa, x, r);                              \
+	}
+
+// r[i] = x.val[i], the check lane is not read
+#define AC_SOA_DECODE(fun, S, V)                                               \
+	AC_INLINE void fun##_soa(const S *x, V *r)                             \
+	{                                                                      \
+		for (size_t i = 0; i < x->n; i++) {                            \
+			r[i] = x->val[i];                                      \
+		}                                                              \
+	}
+
+// r[i] = fun(x[i], y[i]) for i < r->n. x and y must hold at least r->n elements.
+#define AC_SOA_BINARY_KERNEL(attr, fun, kind, pfx, S, T)                       \
+	attr void fun##_soa_##kind(const S *x, const S *y, S *r)               \
+	{                                                                      \
+		const __typeof__(*x->val) *xv = x->val, *yv = y->val;          \
+		const __typeof__(*x->check) *xc = x->check, *yc = y->check;    \
+		__typeof__(r->val) rv = r->val;                                \
+		__typeof__(r->check) rc = r->check;                            \
+		for (size_t i = 0; i < r->n; i++) {                            \
+			T a, b;                                                \
+			a.val = xv[i];                                         \
+			a.check = xc[i];                                       \
+			b.val = yv[i];                                         \
+			b.check = yc[i];                                       \
+			T e = fun(a, b);                                       \
+			rv[i] = e.val;                                         \
+			rc[i] = pfx##soa_pack_check(e.check);                  \
+		}                                                              \
+	}
+#define AC_SOA_BINARY(fun, pfx, S, T)                                          \
+	AC_BATCH_KERNEL(                                                       \
+		AC_SOA_BINARY_KERNEL(AC_BATCH_AVX2, fun, avx2, pfx, S, T))     \
+	AC_SOA_BINARY_KERNEL(AC_BATCH_SCALAR, fun, scalar, pfx, S, T)          \
+	AC_INLINE void fun##_soa(const S *x, const S *y, S *r)                 \
+	{                                                                      \
+		AC_BATCH_SELECT(fun##_soa, x, y, r);                           \
+	}
+
+// r[i] = fun(x[i]) for unary operations
+#define AC_SOA_UNARY_KERNEL(attr, fun, kind, pfx, S, T)                        \
+	attr void fun##_soa_##kind(const S *x, S *r)                           \
+	{                                                                      \
+		const __typeof__(*x->val) *xv = x->val;                        \
+		const __typeof__(*x->check) *xc = x->check;                    \
+		__typeof__(r->val) rv = r->val;                                \
+		__typeof__(r->check) rc = r->check;                            \
+		for (size_t i = 0; i < r->n; i++) {                            \
+			T a;                                                   \
+			a.val = xv[i];                                         \
+			a.check = xc[i];                                       \
+			T e = fun(a);                                          \
+			rv[i] = e.val;                                         \
+			rc[i] = pfx##soa_pack_check(e.check);                  \
+		}                                                              \
+	}
+#define AC_SOA_UNARY(fun, pfx, S, T)                                           \
+	AC_BATCH_KERNEL(                                                       \
+		AC_SOA_UNARY_KERNEL(AC_BATCH_AVX2, fun, avx2, pfx, S, T))      \
+	AC_SOA_UNARY_KERNEL(AC_BATCH_SCALAR, fun, scalar, pfx, S, T)           \
+	AC_INLINE void fun##_soa(const S *x, S *r)                             \
+	{                                                                      \
+		AC_BATCH_SELECT(fun##_soa, x, r);                              \
+	}
+
+// Returns 1 if the check lane matches val % A for all elements. The value lane is reduced in one pass and
+// compared against the separately streamed check lane, the loop does not stop at the first fault.
+#define AC_SOA_CHECK_KERNEL(attr, fun, kind, S, A)                             \
+	attr void fun##_soa_##kind(const S *x, int *ok)                        \
+	{                                                                      \
+		const __typeof__(*x->val) *xv = x->val;                        \
+		const __typeof__(*x->check) *xc = x->check;                    \
+		int r = 1;                                                     \
+		for (size_t i = 0; i < x->n; i++) {                            \
+			r &= (__typeof__(*x->check))(xv[i] % (A)) == xc[i];    \
+		}                                                              \
+		*ok = r;                                                       \
+	}
+#define AC_SOA_CHECK(fun, S, A)                                                \
+	AC_BATCH_KERNEL(AC_SOA_CHECK_KERNEL(AC_BATCH_AVX2, fun, avx2, S, A))   \
+	AC_SOA_CHECK_KERNEL(AC_BATCH_SCALAR, fun, scalar, S, A)                \
+	AC_INLINE int fun##_soa(const S *x)                                    \
+	{                                                                      \
+		int ok;                                                        \
+		AC_BATCH_SELECT(fun##_soa, x, &ok);                            \
+		return ok;                                                     \
+	}
+
+// Container types, access functions and batch operations of one residue coding. S/US are the names of the
+// container types, T/UT the interleaved types, V/UV the value types and A the modulus.
+#define AC_SOA_DEFINE(sfx, S, US, T, UT, V, UV, A)                             \
+	AC_SOA_TYPE(S, V, int8_t)                                              \
+	AC_SOA_TYPE(US, UV, uint8_t)                                           \
+	AC_SOA_ACCESS(, sfx, S, T, V, int8_t)                                  \
+	AC_SOA_ACCESS(u_, sfx, US, UT, UV, uint8_t)                            \
+	AC_SOA_ENCODE(encode_##sfx, S, V)                                      \
+	AC_SOA_ENCODE(u_encode_##sfx, US, UV)                                  \
+	AC_SOA_DECODE(decode_##sfx, S, V)                                      \
+	AC_SOA_DECODE(u_decode_##sfx, US, UV)                                  \
+	AC_SOA_CHECK(check_##sfx, S, A)                                        \
+	AC_SOA_CHECK(u_check_##sfx, US, A)                                     \
+	AC_SOA_BINARY(add_##sfx, , S, T)                                       \
+	AC_SOA_BINARY(u_add_##sfx, u_, US, UT)                                 \
+	AC_SOA_BINARY(sub_##sfx, , S, T)                                       \
+	AC_SOA_BINARY(u_sub_##sfx, u_, US, UT)                                 \
+	AC_SOA_BINARY(mul_##sfx, , S, T)                                       \
+	AC_SOA_BINARY(u_mul_##sfx, u_, US, UT)                                 \
+	AC_SOA_BINARY(div_##sfx, , S, T)                                       \
+	AC_SOA_BINARY(u_div_##sfx, u_, US, UT)                                 \
+	AC_SOA_BINARY(mod_##sfx, , S, T)                                       \
+	AC_SOA_BINARY(u_mod_##sfx, u_, US, UT)                                 \
+	AC_SOA_BINARY(eq_##sfx, , S, T)                                        \
+	AC_SOA_BINARY(u_eq_##sfx, u_, US, UT)                                  \
+	AC_SOA_BINARY(neq_##sfx, , S, T)                                       \
+	AC_SOA_BINARY(u_neq_##sfx, u_, US, UT)                                 \
+	AC_SOA_BINARY(less_##sfx, , S, T)                                      \
+	AC_SOA_BINARY(u_less_##sfx, u_, US, UT)                                \
+	AC_SOA_BINARY(grt_##sfx, , S, T)                                       \
+	AC_SOA_BINARY(u_grt_##sfx, u_, US, UT)                                 \
+	AC_SOA_BINARY(leq_##sfx, , S, T)                                       \
+	AC_SOA_BINARY(u_leq_##sfx, u_, US, UT)                                 \
+	AC_SOA_BINARY(geq_##sfx, , S, T)                                       \
+	AC_SOA_BINARY(u_geq_##sfx, u_, US, UT)                                 \
+	AC_SOA_BINARY(land_##sfx, , S, T)                                      \
+	AC_SOA_BINARY(u_land_##sfx, u_, US, UT)                                \
+	AC_SOA_BINARY(lor_##sfx, , S, T)                                       \
+	AC_SOA_BINARY(u_lor_##sfx, u_, US, UT)                                 \
+	AC_SOA_BINARY(and_##sfx, , S, T)                                       \
+	AC_SOA_BINARY(u_and_##sfx, u_, US, UT)                                 \
+	AC_SOA_BINARY(or_##sfx, , S, T)                                        \
+	AC_SOA_BINARY(u_or_##sfx, u_, US, UT)                                  \
+	AC_SOA_BINARY(xor_##sfx, , S, T)                                       \
+	AC_SOA_BINARY(u_xor_##sfx, u_, US, UT)                                 \
+	AC_SOA_UNARY(neg_##sfx, , S, T)                                        \
+	AC_SOA_UNARY(u_neg_##sfx, u_, US, UT)
+
+#ifdef __cplusplus
+}
+#endif //__cplusplus
+
+#endif //RESIDUE_SOA_H_
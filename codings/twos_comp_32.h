@@ -21,6 +21,7 @@ extern "C" {
 #endif //__cplusplus
 
 #include "common.h"
+#include "batch.h"
 #include "helpers.h"
 #include <stdint.h>
 #include <stdlib.h>
@@ -136,151 +137,83 @@ AC_INLINE uint32c1_t u_mod_32c1(uint32c1_t x_c1, uint32c1_t y_c1)
 
 AC_INLINE int32c1_t eq_32c1(int32c1_t x_c1, int32c1_t y_c1)
 {
-	int32c1_t r_c1 = 0;
-	if (x_c1 == y_c1) {
-		r_c1 = A1_32;
-	}
+	int32c1_t r_c1 = A1_32 & AC_MASK(int32c1_t, x_c1 == y_c1);
 	return r_c1;
 }
 AC_INLINE uint32c1_t u_eq_32c1(uint32c1_t x_c1, uint32c1_t y_c1)
 {
-	uint32c1_t r_c1 = 0;
-	if (x_c1 == y_c1) {
-		r_c1 = A1_32;
-	}
+	uint32c1_t r_c1 = A1_32 & AC_MASK(uint32c1_t, x_c1 == y_c1);
 	return r_c1;
 }
 
 AC_INLINE int32c1_t neq_32c1(int32c1_t x_c1, int32c1_t y_c1)
 {
-	int32c1_t r_c1 = 0;
-	if (x_c1 != y_c1) {
-		r_c1 = A1_32;
-	}
+	int32c1_t r_c1 = A1_32 & AC_MASK(int32c1_t, x_c1 != y_c1);
 	return r_c1;
 }
 AC_INLINE uint32c1_t u_neq_32c1(uint32c1_t x_c1, uint32c1_t y_c1)
 {
-	uint32c1_t r_c1 = 0;
-	if (x_c1 != y_c1) {
-		r_c1 = A1_32;
-	}
+	uint32c1_t r_c1 = A1_32 & AC_MASK(uint32c1_t, x_c1 != y_c1);
 	return r_c1;
 }
 
 AC_INLINE int32c1_t less_32c1(int32c1_t x_c1, int32c1_t y_c1)
 {
-	int32c1_t r_c1 = 0;
-	if (x_c1 > y_c1) {
-		r_c1 = A1_32;
-	}
+	int32c1_t r_c1 = A1_32 & AC_MASK(int32c1_t, x_c1 > y_c1);
 	return r_c1;
 }
 AC_INLINE uint32c1_t u_less_32c1(uint32c1_t x_c1, uint32c1_t y_c1)
 {
-	uint32c1_t r_c1 = 0;
-	if (x_c1 > y_c1) {
-		r_c1 = A1_32;
-	}
 	// x=0 y=0 ->False
 	// x>0 y=0 ->False
 	// x=0 y>0 ->True
-	if (y_c1 == 0) {
-		r_c1 = 0;
-	}
-	if (x_c1 == 0 && y_c1 != 0) {
-		r_c1 = A1_32;
-	}
+	int c = (y_c1 != 0) & ((x_c1 > y_c1) | (x_c1 == 0));
+	uint32c1_t r_c1 = A1_32 & AC_MASK(uint32c1_t, c);
 	return r_c1;
 }
 
 AC_INLINE int32c1_t grt_32c1(int32c1_t x_c1, int32c1_t y_c1)
 {
-	int32c1_t r_c1 = 0;
-	if (x_c1 < y_c1) {
-		r_c1 = A1_32;
-	}
+	int32c1_t r_c1 = A1_32 & AC_MASK(int32c1_t, x_c1 < y_c1);
 	return r_c1;
 }
 AC_INLINE uint32c1_t u_grt_32c1(uint32c1_t x_c1, uint32c1_t y_c1)
 {
-	uint32c1_t r_c1 = 0;
-	if (x_c1 < y_c1) {
-		r_c1 = A1_32;
-	}
 	// x=0 y=0 ->False
 	// x>0 y=0 ->True
 	// x=0 y>0 ->False
-	if (y_c1 == 0) {
-		if (x_c1 == 0) {
-			r_c1 = 0;
-		} else {
-			r_c1 = A1_32;
-		}
-	}
-	if (x_c1 == 0 && y_c1 != 0) {
-		r_c1 = 0;
-	}
+	int c = (x_c1 != 0) & ((x_c1 < y_c1) | (y_c1 == 0));
+	uint32c1_t r_c1 = A1_32 & AC_MASK(uint32c1_t, c);
 	return r_c1;
 }
 
 AC_INLINE int32c1_t leq_32c1(int32c1_t x_c1, int32c1_t y_c1)
 {
-	int32c1_t r_c1 = 0;
-	if (x_c1 >= y_c1) {
-		r_c1 = A1_32;
-	}
+	int32c1_t r_c1 = A1_32 & AC_MASK(int32c1_t, x_c1 >= y_c1);
 	return r_c1;
 }
 AC_INLINE uint32c1_t u_leq_32c1(uint32c1_t x_c1, uint32c1_t y_c1)
 {
-	uint32c1_t r_c1 = 0;
-	if (x_c1 >= y_c1) {
-		r_c1 = A1_32;
-	}
 	// x=0 y=0 ->True
 	// x>0 y=0 ->False
 	// x=0 y>0 ->True
-	if (y_c1 == 0) {
-		if (x_c1 == 0) {
-			r_c1 = A1_32;
-		} else {
-			r_c1 = 0;
-		}
-	}
-	if (x_c1 == 0) {
-		r_c1 = A1_32;
-	}
+	int c = (x_c1 == 0) | ((y_c1 != 0) & (x_c1 >= y_c1));
+	uint32c1_t r_c1 = A1_32 & AC_MASK(uint32c1_t, c);
 	return r_c1;
 }
 
 AC_INLINE int32c1_t geq_32c1(int32c1_t x_c1, int32c1_t y_c1)
 {
-	int32c1_t r_c1 = 0;
-	if (x_c1 <= y_c1) {
-		r_c1 = A1_32;
-	}
+	int32c1_t r_c1 = A1_32 & AC_MASK(int32c1_t, x_c1 <= y_c1);
 	return r_c1;
 }
 AC_INLINE uint32c1_t u_geq_32c1(uint32c1_t x_c1, uint32c1_t y_c1)
 {
-	uint32c1_t r_c1 = 0;
-	if (x_c1 <= y_c1) {
-		r_c1 = A1_32;
-	}
 	// x=0 y=0 ->True
 	// x>0 y=0 ->True
 	// x=0 y>0 ->False
-	if (x_c1 == 0) {
-		if (y_c1 == 0) {
-			r_c1 = A1_32;
-		} else {
-			r_c1 = 0;
-		}
-	}
-	if (y_c1 == 0) {
-		r_c1 = A1_32;
-	}
+	int c = (y_c1 == 0) | ((x_c1 != 0) & (x_c1 <= y_c1));
+	uint32c1_t r_c1 = A1_32 & AC_MASK(uint32c1_t, c);
 	return r_c1;
 }
 
@@ -309,20 +242,20 @@ AC_INLINE uint32c1_t u_shr_32c1(uint32c1_t x_c1, uint32c1_t y_c1)
 
 AC_INLINE int32c1_t land_32c1(int32c1_t x_c1, int32c1_t y_c1)
 {
-	return -(x_c1 && y_c1);
+	return -((x_c1 != 0) & (y_c1 != 0));
 }
 AC_INLINE uint32c1_t u_land_32c1(uint32c1_t x_c1, uint32c1_t y_c1)
 {
-	return -(x_c1 && y_c1);
+	return -((x_c1 != 0) & (y_c1 != 0));
 }
 
 AC_INLINE int32c1_t lor_32c1(int32c1_t x_c1, int32c1_t y_c1)
 {
-	return -(x_c1 || y_c1);
+	return -((x_c1 | y_c1) != 0);
 }
 AC_INLINE uint32c1_t u_lor_32c1(uint32c1_t x_c1, uint32c1_t y_c1)
 {
-	return -(x_c1 || y_c1);
+	return -((x_c1 | y_c1) != 0);
 }
 
 AC_INLINE int32c1_t and_32c1(int32c1_t x_c1, int32c1_t y_c1)
@@ -397,6 +330,9 @@ AC_INLINE uint32c1_t u_xor_32c1(uint32c1_t x_c1, uint32c1_t y_c1)
 	return r_d1;
 }
 
+AC_BATCH_DEFINE_OPS(32c1, int32c1_t, uint32c1_t, int32_t, uint32_t)
+AC_BATCH_DEFINE_CHECK(32c1, int32c1_t, uint32c1_t, int32c1_t, uint32c1_t)
+
 #ifdef __cplusplus
 }
 #endif //__cplusplus
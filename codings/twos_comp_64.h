@@ -21,6 +21,7 @@ extern "C" {
 #endif //__cplusplus
 
 #include "common.h"
+#include "batch.h"
 #include "helpers.h"
 #include <stdint.h>
 #include <stdlib.h>
@@ -136,151 +137,83 @@ AC_INLINE uint64c1_t u_mod_64c1(uint64c1_t x_c1, uint64c1_t y_c1)
 
 AC_INLINE int64c1_t eq_64c1(int64c1_t x_c1, int64c1_t y_c1)
 {
-	int64c1_t r_c1 = 0;
-	if (x_c1 == y_c1) {
-		r_c1 = A1_64;
-	}
+	int64c1_t r_c1 = A1_64 & AC_MASK(int64c1_t, x_c1 == y_c1);
 	return r_c1;
 }
 AC_INLINE uint64c1_t u_eq_64c1(uint64c1_t x_c1, uint64c1_t y_c1)
 {
-	uint64c1_t r_c1 = 0;
-	if (x_c1 == y_c1) {
-		r_c1 = A1_64;
-	}
+	uint64c1_t r_c1 = A1_64 & AC_MASK(uint64c1_t, x_c1 == y_c1);
 	return r_c1;
 }
 
 AC_INLINE int64c1_t neq_64c1(int64c1_t x_c1, int64c1_t y_c1)
 {
-	int64c1_t r_c1 = 0;
-	if (x_c1 != y_c1) {
-		r_c1 = A1_64;
-	}
+	int64c1_t r_c1 = A1_64 & AC_MASK(int64c1_t, x_c1 != y_c1);
 	return r_c1;
 }
 AC_INLINE uint64c1_t u_neq_64c1(uint64c1_t x_c1, uint64c1_t y_c1)
 {
-	uint64c1_t r_c1 = 0;
-	if (x_c1 != y_c1) {
-		r_c1 = A1_64;
-	}
+	uint64c1_t r_c1 = A1_64 & AC_MASK(uint64c1_t, x_c1 != y_c1);
 	return r_c1;
 }
 
 AC_INLINE int64c1_t less_64c1(int64c1_t x_c1, int64c1_t y_c1)
 {
-	int64c1_t r_c1 = 0;
-	if (x_c1 > y_c1) {
-		r_c1 = A1_64;
-	}
+	int64c1_t r_c1 = A1_64 & AC_MASK(int64c1_t, x_c1 > y_c1);
 	return r_c1;
 }
 AC_INLINE uint64c1_t u_less_64c1(uint64c1_t x_c1, uint64c1_t y_c1)
 {
-	uint64c1_t r_c1 = 0;
-	if (x_c1 > y_c1) {
-		r_c1 = A1_64;
-	}
 	// x=0 y=0 ->False
 	// x>0 y=0 ->False
 	// x=0 y>0 ->True
-	if (y_c1 == 0) {
-		r_c1 = 0;
-	}
-	if (x_c1 == 0 && y_c1 != 0) {
-		r_c1 = A1_64;
-	}
+	int c = (y_c1 != 0) & ((x_c1 > y_c1) | (x_c1 == 0));
+	uint64c1_t r_c1 = A1_64 & AC_MASK(uint64c1_t, c);
 	return r_c1;
 }
 
 AC_INLINE int64c1_t grt_64c1(int64c1_t x_c1, int64c1_t y_c1)
 {
-	int64c1_t r_c1 = 0;
-	if (x_c1 < y_c1) {
-		r_c1 = A1_64;
-	}
+	int64c1_t r_c1 = A1_64 & AC_MASK(int64c1_t, x_c1 < y_c1);
 	return r_c1;
 }
 AC_INLINE uint64c1_t u_grt_64c1(uint64c1_t x_c1, uint64c1_t y_c1)
 {
-	uint64c1_t r_c1 = 0;
-	if (x_c1 < y_c1) {
-		r_c1 = A1_64;
-	}
 	// x=0 y=0 ->False
 	// x>0 y=0 ->True
 	// x=0 y>0 ->False
-	if (y_c1 == 0) {
-		if (x_c1 == 0) {
-			r_c1 = 0;
-		} else {
-			r_c1 = A1_64;
-		}
-	}
-	if (x_c1 == 0 && y_c1 != 0) {
-		r_c1 = 0;
-	}
+	int c = (x_c1 != 0) & ((x_c1 < y_c1) | (y_c1 == 0));
+	uint64c1_t r_c1 = A1_64 & AC_MASK(uint64c1_t, c);
 	return r_c1;
 }
 
 AC_INLINE int64c1_t leq_64c1(int64c1_t x_c1, int64c1_t y_c1)
 {
-	int64c1_t r_c1 = 0;
-	if (x_c1 >= y_c1) {
-		r_c1 = A1_64;
-	}
+	int64c1_t r_c1 = A1_64 & AC_MASK(int64c1_t, x_c1 >= y_c1);
 	return r_c1;
 }
 AC_INLINE uint64c1_t u_leq_64c1(uint64c1_t x_c1, uint64c1_t y_c1)
 {
-	uint64c1_t r_c1 = 0;
-	if (x_c1 >= y_c1) {
-		r_c1 = A1_64;
-	}
 	// x=0 y=0 ->True
 	// x>0 y=0 ->False
 	// x=0 y>0 ->True
-	if (y_c1 == 0) {
-		if (x_c1 == 0) {
-			r_c1 = A1_64;
-		} else {
-			r_c1 = 0;
-		}
-	}
-	if (x_c1 == 0) {
-		r_c1 = A1_64;
-	}
+	int c = (x_c1 == 0) | ((y_c1 != 0) & (x_c1 >= y_c1));
+	uint64c1_t r_c1 = A1_64 & AC_MASK(uint64c1_t, c);
 	return r_c1;
 }
 
 AC_INLINE int64c1_t geq_64c1(int64c1_t x_c1, int64c1_t y_c1)
 {
-	int64c1_t r_c1 = 0;
-	if (x_c1 <= y_c1) {
-		r_c1 = A1_64;
-	}
+	int64c1_t r_c1 = A1_64 & AC_MASK(int64c1_t, x_c1 <= y_c1);
 	return r_c1;
 }
 AC_INLINE uint64c1_t u_geq_64c1(uint64c1_t x_c1, uint64c1_t y_c1)
 {
-	uint64c1_t r_c1 = 0;
-	if (x_c1 <= y_c1) {
-		r_c1 = A1_64;
-	}
 	// x=0 y=0 ->True
 	// x>0 y=0 ->True
 	// x=0 y>0 ->False
-	if (x_c1 == 0) {
-		if (y_c1 == 0) {
-			r_c1 = A1_64;
-		} else {
-			r_c1 = 0;
-		}
-	}
-	if (y_c1 == 0) {
-		r_c1 = A1_64;
-	}
+	int c = (y_c1 == 0) | ((x_c1 != 0) & (x_c1 <= y_c1));
+	uint64c1_t r_c1 = A1_64 & AC_MASK(uint64c1_t, c);
 	return r_c1;
 }
 
@@ -309,20 +242,20 @@ AC_INLINE uint64c1_t u_shr_64c1(uint64c1_t x_c1, uint64c1_t y_c1)
 
 AC_INLINE int64c1_t land_64c1(int64c1_t x_c1, int64c1_t y_c1)
 {
-	return -(x_c1 && y_c1);
+	return -((x_c1 != 0) & (y_c1 != 0));
 }
 AC_INLINE uint64c1_t u_land_64c1(uint64c1_t x_c1, uint64c1_t y_c1)
 {
-	return -(x_c1 && y_c1);
+	return -((x_c1 != 0) & (y_c1 != 0));
 }
 
 AC_INLINE int64c1_t lor_64c1(int64c1_t x_c1, int64c1_t y_c1)
 {
-	return -(x_c1 || y_c1);
+	return -((x_c1 | y_c1) != 0);
 }
 AC_INLINE uint64c1_t u_lor_64c1(uint64c1_t x_c1, uint64c1_t y_c1)
 {
-	return -(x_c1 || y_c1);
+	return -((x_c1 | y_c1) != 0);
 }
 
 AC_INLINE int64c1_t and_64c1(int64c1_t x_c1, int64c1_t y_c1)
@@ -397,6 +330,9 @@ AC_INLINE uint64c1_t u_xor_64c1(uint64c1_t x_c1, uint64c1_t y_c1)
 	return r_d1;
 }
 
+AC_BATCH_DEFINE_OPS(64c1, int64c1_t, uint64c1_t, int64_t, uint64_t)
+AC_BATCH_DEFINE_CHECK(64c1, int64c1_t, uint64c1_t, int64c1_t, uint64c1_t)
+
 #ifdef __cplusplus
 }
 #endif //__cplusplus
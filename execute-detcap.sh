@@ -3,4 +3,7 @@ cd results
 ./../build/detcap cd > metrics.log
 ./../build/detcap trans > trans.log
 ./../build/detcap perm > perm.log
-./../build/detcap perman > perm_an.log
\ No newline at end of file
+./../build/detcap perman > perm_an.log
+./../build/detcap-mc -f trans > mc_trans.log
+./../build/detcap-mc -f flip -b 2 > mc_flip2.log
+./../build/detcap-mc -f perm > mc_perm.log
\ No newline at end of file
@@ -1,12 +1,13 @@
 ./build.sh
 cd plots
-./../build/performance-none32 ../src/performance/rands.dat
-./../build/performance-none64 ../src/performance/rands.dat
-./../build/performance-an32 ../src/performance/rands.dat
-./../build/performance-an64 ../src/performance/rands.dat
-./../build/performance-onecmp32 ../src/performance/rands.dat
-./../build/performance-onecmp64 ../src/performance/rands.dat
-./../build/performance-twocmp32 ../src/performance/rands.dat
-./../build/performance-twocmp64 ../src/performance/rands.dat
-./../build/performance-res32 ../src/performance/rands.dat
-./../build/performance-res64 ../src/performance/rands.dat
\ No newline at end of file
+./../build/genrand 500000 ../src/performance/rands.dat
+./../build/performance ../src/performance/rands.dat
+for SET in noov ov; do
+./../build/performance -e res32,res64,resbl32,resbl64 -i $SET -o res ../src/performance/rands.dat
+done
+for SET in small edge ovpair sign control; do
+./../build/performance -m tp -i $SET -o profile ../src/performance/rands.dat
+done
+
+./../build/performance -e an64,res64 -k add,mul,div -W 4K:1M -o sweep ../src/performance/rands.dat
+./../build/performance -e an64,res64 -k add,mul,div -t 1,2,4 -o scale ../src/performance/rands.dat
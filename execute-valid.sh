@@ -3,4 +3,9 @@
 cd mul_validation
 ./../build/val-mul
 ./../build/val-mul-enc
+./../build/val-mul-ckpt
+for CODING in none32 none64 an32 an64 an32df an64df an64limb onecmp32 onecmp64 twocmp32 twocmp64 res32 res64 resbl32 resbl64; do
+./../build/val-gemm-$CODING 100 100 100 $(nproc)
+./../build/val-ctrl-$CODING
+done
 python evaluate.py
\ No newline at end of file
@@ -0,0 +1,41 @@
+/**
+ * @copyright: (c) 2022, Institute for Control Engineering of Machine Tools and Manufacturing Units,
+ *             University of Stuttgart
+ *             All rights reserved. Licensed under the Apache License, Version 2.0 (the "License");
+ *             you may not use this file except in compliance with the License.
+ *             You may obtain a copy of the License at
+ *                  http://www.apache.org/licenses/LICENSE-2.0
+ *             Unless required by applicable law or agreed to in writing, software
+ *             distributed under the License is distributed on an "AS IS" BASIS,
+ *             WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *             See the License for the specific language governing permissions and
+ *             limitations under the License.
+ * @author: Marc Fischer <marc.fischer@isw.uni-stuttgart.de>
+ * @description: Native and encoded control kernels, see ctrl.h
+ */
+#include "ctrl.h"
+
+void ctrl_init(void)
+{
+#ifdef AN64
+	init();
+#endif
+}
+
+#define CTRL_FN(name) ctrl_##name
+#define CTRL_T TEST_TYPE
+#define CTRL_C(x) ((TEST_TYPE)(x))
+#define CTRL_ADD(x, y) ((x) + (y))
+#define CTRL_SUB(x, y) ((x) - (y))
+#define CTRL_MUL(x, y) ((x) * (y))
+#define CTRL_DIV(x, y) ((x) / (y))
+#include "ctrl_kernels.h"
+
+#define CTRL_FN(name) ctrl_enc_##name
+#define CTRL_T ENC_TYPE
+#define CTRL_C(x) ENCODEDFUNCTION(encode)(x)
+#define CTRL_ADD(x, y) ENCODEDFUNCTION(add)(x, y)
+#define CTRL_SUB(x, y) ENCODEDFUNCTION(sub)(x, y)
+#define CTRL_MUL(x, y) ENCODEDFUNCTION(mul)(x, y)
+#define CTRL_DIV(x, y) ENCODEDFUNCTION(div)(x, y)
+#include "ctrl_kernels.h"
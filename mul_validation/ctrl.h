@@ -0,0 +1,65 @@
+/**
+ * @copyright: (c) 2022, Institute for Control Engineering of Machine Tools and Manufacturing Units,
+ *             University of Stuttgart
+ *             All rights reserved. Licensed under the Apache License, Version 2.0 (the "License");
+ *             you may not use this file except in compliance with the License.
+ *             You may obtain a copy of the License at
+ *                  http://www.apache.org/licenses/LICENSE-2.0
+ *             Unless required by applicable law or agreed to in writing, software
+ *             distributed under the License is distributed on an "AS IS" BASIS,
+ *             WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *             See the License for the specific language governing permissions and
+ *             limitations under the License.
+ * @author: Marc Fischer <marc.fischer@isw.uni-stuttgart.de>
+ * @description: Native and encoded kernels of a machine tool control cycle on N samples: PID controller, FIR and
+ *               IIR (biquad) filter, linear and circular interpolation, setpoint ramp and the chained cycle of
+ *               ramp, FIR and PID. All values are fixed point numbers with CTRL_Q fractional bits, the
+ *               coefficients are scaled by CTRL_ONE. The coding is selected by the definitions of
+ *               coding_defines.h.
+ */
+#ifndef CTRL_H_
+#define CTRL_H_ 1
+
+#include <stddef.h>
+#include <stdint.h>
+#include "coding_defines.h"
+
+#define CTRL_Q 8
+#define CTRL_ONE (1 << CTRL_Q)
+#define CTRL_TAPS 16
+// Decay of the PID integrator per sample, sum -= sum / CTRL_LEAK. Bounds the integrator to about CTRL_LEAK times
+// the largest error, so it does not wind up for any n.
+#define CTRL_LEAK 64
+// Largest n: the linear interpolation multiplies the 12 bit distance with the step
+#define CTRL_MAX_N (INT32_MAX / 4096)
+
+// Initializes the coding of the kernels (AN64), has to be called before the encoded kernels
+void ctrl_init(void);
+
+// u = (KP*e + KI*sum + KD*(e - e_prev)) / ONE with e = sp - y and the leaky integrator sum = sum - sum/LEAK + e
+void ctrl_pid(size_t n, const TEST_TYPE *sp, const TEST_TYPE *y, TEST_TYPE *u);
+// y[i] = sum(h[k] * x[i-k]) / ONE, x[i] = 0 for i < 0
+void ctrl_fir(size_t n, const TEST_TYPE *x, TEST_TYPE *y);
+// Low pass biquad in direct form I: y[i] = (b0*x[i] + b1*x[i-1] + b2*x[i-2] - a1*y[i-1] - a2*y[i-2]) / ONE
+void ctrl_iir(size_t n, const TEST_TYPE *x, TEST_TYPE *y);
+// Line from (x0, y0) to (x1, y1) in n steps
+void ctrl_lin(size_t n, const TEST_TYPE *p, TEST_TYPE *px, TEST_TYPE *py);
+// Circle around the origin starting at (r, 0), integrated with the rotation x -= y*e, y += x*e
+void ctrl_circ(size_t n, TEST_TYPE r, TEST_TYPE *px, TEST_TYPE *py);
+// Setpoint of the acceleration profile acc: v += acc[i], p += v / ONE
+void ctrl_ramp(size_t n, const TEST_TYPE *acc, TEST_TYPE *p);
+// Control cycle: setpoint by ctrl_ramp, measurement filtered by ctrl_fir, control value by ctrl_pid. tmp has
+// 2*n values.
+void ctrl_cycle(size_t n, const TEST_TYPE *acc, const TEST_TYPE *meas,
+		TEST_TYPE *tmp, TEST_TYPE *u);
+
+void ctrl_enc_pid(size_t n, const ENC_TYPE *sp, const ENC_TYPE *y, ENC_TYPE *u);
+void ctrl_enc_fir(size_t n, const ENC_TYPE *x, ENC_TYPE *y);
+void ctrl_enc_iir(size_t n, const ENC_TYPE *x, ENC_TYPE *y);
+void ctrl_enc_lin(size_t n, const ENC_TYPE *p, ENC_TYPE *px, ENC_TYPE *py);
+void ctrl_enc_circ(size_t n, ENC_TYPE r, ENC_TYPE *px, ENC_TYPE *py);
+void ctrl_enc_ramp(size_t n, const ENC_TYPE *acc, ENC_TYPE *p);
+void ctrl_enc_cycle(size_t n, const ENC_TYPE *acc, const ENC_TYPE *meas,
+		    ENC_TYPE *tmp, ENC_TYPE *u);
+
+#endif //CTRL_H_
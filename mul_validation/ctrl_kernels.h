@@ -0,0 +1,152 @@
+/**
+ * @copyright: (c) 2022, Institute for Control Engineering of Machine Tools and Manufacturing Units,
+ *             University of Stuttgart
+ *             All rights reserved. Licensed under the Apache License, Version 2.0 (the "License");
+ *             you may not use this file except in compliance with the License.
+ *             You may obtain a copy of the License at
+ *                  http://www.apache.org/licenses/LICENSE-2.0
+ *             Unless required by applicable law or agreed to in writing, software
+ *             distributed under the License is distributed on an "AS IS" BASIS,
+ *             WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *             See the License for the specific language governing permissions and
+ *             limitations under the License.
+ * @author: Marc Fischer <marc.fischer@isw.uni-stuttgart.de>
+ * @description: Generates the control kernels of ctrl.h. CTRL_FN(name) gives the name of a kernel, CTRL_T the
+ *               type of the values, CTRL_C(x) a constant and CTRL_ADD, CTRL_SUB, CTRL_MUL and CTRL_DIV the
+ *               operations. They have to be defined before the include. The header has no include guard and
+ *               is included once for the native and once for the encoded kernels, so both compute the same
+ *               sequence of operations and the decoded results are equal to the native ones.
+ */
+
+#if !defined(CTRL_FN) || !defined(CTRL_T) || !defined(CTRL_C) ||              \
+	!defined(CTRL_ADD) || !defined(CTRL_SUB) || !defined(CTRL_MUL) ||     \
+	!defined(CTRL_DIV)
+#error "CTRL_FN, CTRL_T, CTRL_C, CTRL_ADD, CTRL_SUB, CTRL_MUL and CTRL_DIV must be defined before including ctrl_kernels.h"
+#endif
+
+// Coefficients, scaled by CTRL_ONE
+#ifndef CTRL_COEFFICIENTS
+#define CTRL_COEFFICIENTS 1
+static const int ctrl_pid_k[3] = { 384, 8, 64 };
+static const int ctrl_fir_h[CTRL_TAPS] = { 1,  3,  6,  11, 17, 23, 28, 39,
+					   39, 28, 23, 17, 11, 6,  3,  1 };
+static const int ctrl_iir_b[3] = { 16, 32, 16 };
+static const int ctrl_iir_a[2] = { -358, 128 };
+// Angle per step of the circle, 1/64 rad
+static const int ctrl_circ_e = 4;
+#endif
+
+void CTRL_FN(pid)(size_t n, const CTRL_T *sp, const CTRL_T *y, CTRL_T *u)
+{
+	const CTRL_T kp = CTRL_C(ctrl_pid_k[0]);
+	const CTRL_T ki = CTRL_C(ctrl_pid_k[1]);
+	const CTRL_T kd = CTRL_C(ctrl_pid_k[2]);
+	const CTRL_T one = CTRL_C(CTRL_ONE);
+	const CTRL_T leak = CTRL_C(CTRL_LEAK);
+	CTRL_T sum = CTRL_C(0);
+	CTRL_T prev = CTRL_C(0);
+	for (size_t i = 0; i < n; i++) {
+		CTRL_T e = CTRL_SUB(sp[i], y[i]);
+		sum = CTRL_ADD(CTRL_SUB(sum, CTRL_DIV(sum, leak)), e);
+		CTRL_T r = CTRL_ADD(CTRL_MUL(kp, e), CTRL_MUL(ki, sum));
+		r = CTRL_ADD(r, CTRL_MUL(kd, CTRL_SUB(e, prev)));
+		u[i] = CTRL_DIV(r, one);
+		prev = e;
+	}
+}
+
+void CTRL_FN(fir)(size_t n, const CTRL_T *x, CTRL_T *y)
+{
+	CTRL_T h[CTRL_TAPS];
+	for (int k = 0; k < CTRL_TAPS; k++) {
+		h[k] = CTRL_C(ctrl_fir_h[k]);
+	}
+	const CTRL_T one = CTRL_C(CTRL_ONE);
+	for (size_t i = 0; i < n; i++) {
+		CTRL_T s = CTRL_C(0);
+		for (size_t k = 0; k < CTRL_TAPS && k <= i; k++) {
+			s = CTRL_ADD(s, CTRL_MUL(h[k], x[i - k]));
+		}
+		y[i] = CTRL_DIV(s, one);
+	}
+}
+
+void CTRL_FN(iir)(size_t n, const CTRL_T *x, CTRL_T *y)
+{
+	const CTRL_T b0 = CTRL_C(ctrl_iir_b[0]);
+	const CTRL_T b1 = CTRL_C(ctrl_iir_b[1]);
+	const CTRL_T b2 = CTRL_C(ctrl_iir_b[2]);
+	const CTRL_T a1 = CTRL_C(ctrl_iir_a[0]);
+	const CTRL_T a2 = CTRL_C(ctrl_iir_a[1]);
+	const CTRL_T one = CTRL_C(CTRL_ONE);
+	CTRL_T x1 = CTRL_C(0), x2 = CTRL_C(0);
+	CTRL_T y1 = CTRL_C(0), y2 = CTRL_C(0);
+	for (size_t i = 0; i < n; i++) {
+		CTRL_T s = CTRL_ADD(CTRL_MUL(b0, x[i]), CTRL_MUL(b1, x1));
+		s = CTRL_ADD(s, CTRL_MUL(b2, x2));
+		s = CTRL_SUB(s, CTRL_MUL(a1, y1));
+		s = CTRL_SUB(s, CTRL_MUL(a2, y2));
+		x2 = x1;
+		x1 = x[i];
+		y2 = y1;
+		y1 = CTRL_DIV(s, one);
+		y[i] = y1;
+	}
+}
+
+void CTRL_FN(lin)(size_t n, const CTRL_T *p, CTRL_T *px, CTRL_T *py)
+{
+	const CTRL_T dx = CTRL_SUB(p[2], p[0]);
+	const CTRL_T dy = CTRL_SUB(p[3], p[1]);
+	const CTRL_T steps = CTRL_C(n);
+	const CTRL_T inc = CTRL_C(1);
+	CTRL_T k = CTRL_C(0);
+	for (size_t i = 0; i < n; i++) {
+		k = CTRL_ADD(k, inc);
+		px[i] = CTRL_ADD(p[0], CTRL_DIV(CTRL_MUL(dx, k), steps));
+		py[i] = CTRL_ADD(p[1], CTRL_DIV(CTRL_MUL(dy, k), steps));
+	}
+}
+
+void CTRL_FN(circ)(size_t n, CTRL_T r, CTRL_T *px, CTRL_T *py)
+{
+	const CTRL_T e = CTRL_C(ctrl_circ_e);
+	const CTRL_T one = CTRL_C(CTRL_ONE);
+	CTRL_T x = r;
+	CTRL_T y = CTRL_C(0);
+	for (size_t i = 0; i < n; i++) {
+		//Uses the new x for y, the circle stays closed
+		x = CTRL_SUB(x, CTRL_DIV(CTRL_MUL(y, e), one));
+		y = CTRL_ADD(y, CTRL_DIV(CTRL_MUL(x, e), one));
+		px[i] = x;
+		py[i] = y;
+	}
+}
+
+void CTRL_FN(ramp)(size_t n, const CTRL_T *acc, CTRL_T *p)
+{
+	const CTRL_T one = CTRL_C(CTRL_ONE);
+	CTRL_T v = CTRL_C(0);
+	CTRL_T pos = CTRL_C(0);
+	for (size_t i = 0; i < n; i++) {
+		v = CTRL_ADD(v, acc[i]);
+		pos = CTRL_ADD(pos, CTRL_DIV(v, one));
+		p[i] = pos;
+	}
+}
+
+void CTRL_FN(cycle)(size_t n, const CTRL_T *acc, const CTRL_T *meas,
+		    CTRL_T *tmp, CTRL_T *u)
+{
+	CTRL_FN(ramp)(n, acc, tmp);
+	CTRL_FN(fir)(n, meas, tmp + n);
+	CTRL_FN(pid)(n, tmp, tmp + n, u);
+}
+
+#undef CTRL_FN
+#undef CTRL_T
+#undef CTRL_C
+#undef CTRL_ADD
+#undef CTRL_SUB
+#undef CTRL_MUL
+#undef CTRL_DIV
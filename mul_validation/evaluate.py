@@ -10,9 +10,13 @@
 #             See the License for the specific language governing permissions and
 #             limitations under the License.
 # @author: Marc Fischer <marc.fischer@isw.uni-stuttgart.de>
-# @description: Calculates the slowdown of the encoded matrix multiplication
+# @description: Calculates the slowdown of the encoded matrix multiplication and the overhead and detection
+#               latency of the deferred check (checkpoints) compared to the per value check and the slowdown of
+#               the tiled matrix multiplication of each coding, also over the number of threads, and the
+#               slowdown of the encoded control kernels
 import pandas as pd
 import pathlib
+import glob
 import os
 
 if __name__ == '__main__':
@@ -28,3 +32,47 @@ if __name__ == '__main__':
     slowdown = dfenc['MEDIAN'] / df['MEDIAN']
     print(slowdown.head())
 
+    # Rows of both files in the order of the block lengths: no check, per value, checkpoints
+    dfckpt = pd.read_csv(os.path.join(
+        localPath, 'mul100-ckpt.csv'), delimiter=';')
+    dflat = pd.read_csv(os.path.join(
+        localPath, 'mul100-ckpt-latency.csv'), delimiter=';')
+    tradeoff = dflat[['BLOCK', 'DETECTED', 'LATENCY_MEAN', 'LATENCY_MAX']].copy()
+    tradeoff['MEDIAN'] = dfckpt['MEDIAN']
+    tradeoff['OVERHEAD'] = dfckpt['MEDIAN'] / dfckpt['MEDIAN'][0] - 1
+    tradeoff['VS_VALUE'] = dfckpt['MEDIAN'] / dfckpt['MEDIAN'][1]
+    print(tradeoff.to_string(index=False))
+
+
+    # Rows of gemm_<coding>.csv: naive reference, tiled native, tiled encoded
+    for filename in sorted(glob.glob(os.path.join(localPath, 'gemm_*.csv'))):
+        if os.path.basename(filename).startswith('gemm_mt_'):
+            continue
+        dfgemm = pd.read_csv(filename, delimiter=';')
+        print('%s: tiled speedup %f, encoded slowdown %f' % (
+            os.path.basename(filename)[5:-4],
+            dfgemm['MEDIAN'][0] / dfgemm['MEDIAN'][1],
+            dfgemm['MEDIAN'][2] / dfgemm['MEDIAN'][1]))
+
+    # Rows of gemm_mt_<coding>_<threads>.csv: native, encoded
+    scaling = {}
+    for filename in glob.glob(os.path.join(localPath, 'gemm_mt_*.csv')):
+        coding, threads = os.path.basename(filename)[8:-4].rsplit('_', 1)
+        dfmt = pd.read_csv(filename, delimiter=';')
+        scaling.setdefault(coding, {})[int(threads)] = dfmt['MEDIAN']
+    for coding, runs in sorted(scaling.items()):
+        print(coding)
+        for threads in sorted(runs):
+            print('  %2d threads: speedup native %f, encoded %f, encoded slowdown %f' % (
+                threads, runs[1][0] / runs[threads][0],
+                runs[1][1] / runs[threads][1],
+                runs[threads][1] / runs[threads][0]))
+
+    # Rows of ctrl_<coding>.csv: native and encoded of each kernel
+    for filename in sorted(glob.glob(os.path.join(localPath, 'ctrl_*.csv'))):
+        dfctrl = pd.read_csv(filename, delimiter=';')
+        print(os.path.basename(filename)[5:-4])
+        for row in range(0, len(dfctrl), 2):
+            kernel = dfctrl['TAGS'][row].split('_START')[0][4:].lower()
+            print('  %-6s encoded slowdown %f' % (
+                kernel, dfctrl['MEDIAN'][row + 1] / dfctrl['MEDIAN'][row]))
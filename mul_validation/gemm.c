@@ -0,0 +1,56 @@
+/**
+ * @copyright: (c) 2022, Institute for Control Engineering of Machine Tools and Manufacturing Units,
+ *             University of Stuttgart
+ *             All rights reserved. Licensed under the Apache License, Version 2.0 (the "License");
+ *             you may not use this file except in compliance with the License.
+ *             You may obtain a copy of the License at
+ *                  http://www.apache.org/licenses/LICENSE-2.0
+ *             Unless required by applicable law or agreed to in writing, software
+ *             distributed under the License is distributed on an "AS IS" BASIS,
+ *             WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *             See the License for the specific language governing permissions and
+ *             limitations under the License.
+ * @author: Marc Fischer <marc.fischer@isw.uni-stuttgart.de>
+ * @description: Native and encoded tiled matrix multiplication
+ */
+#include "gemm.h"
+
+#define GEMM_MINSIZE(x, y) ((x) < (y) ? (x) : (y))
+
+void gemm_init(void)
+{
+#ifdef AN64
+	init();
+#endif
+}
+
+void gemm_ref(size_t m, size_t n, size_t k, const TEST_TYPE_U *a,
+	      const TEST_TYPE_U *b, TEST_TYPE_U *c)
+{
+	for (size_t i = 0; i < m; i++) {
+		for (size_t j = 0; j < n; j++) {
+			TEST_TYPE_U sumVal = 0;
+			for (size_t p = 0; p < k; p++) {
+				sumVal += a[i * k + p] * b[p * n + j];
+			}
+			c[i * n + j] = sumVal;
+		}
+	}
+}
+
+#define GEMM_FN gemm
+#define GEMM_TILE_FN gemm_tile
+#define GEMM_T TEST_TYPE_U
+#define GEMM_ZERO 0
+#define GEMM_ADD(s, x) ((s) + (x))
+#define GEMM_MADD(s, x, y) ((s) + (x) * (y))
+#include "gemm_tile.h"
+
+#define GEMM_FN gemm_enc
+#define GEMM_TILE_FN gemm_enc_tile
+#define GEMM_T ENC_TYPE_U
+#define GEMM_ZERO ENCODEDFUNCTION_U(encode)(0)
+#define GEMM_ADD(s, x) ENCODEDFUNCTION_U(add)(s, x)
+#define GEMM_MADD(s, x, y)                                                     \
+	ENCODEDFUNCTION_U(add)(s, ENCODEDFUNCTION_U(mul)(x, y))
+#include "gemm_tile.h"
@@ -0,0 +1,51 @@
+/**
+ * @copyright: (c) 2022, Institute for Control Engineering of Machine Tools and Manufacturing Units,
+ *             University of Stuttgart
+ *             All rights reserved. Licensed under the Apache License, Version 2.0 (the "License");
+ *             you may not use this file except in compliance with the License.
+ *             You may obtain a copy of the License at
+ *                  http://www.apache.org/licenses/LICENSE-2.0
+ *             Unless required by applicable law or agreed to in writing, software
+ *             distributed under the License is distributed on an "AS IS" BASIS,
+ *             WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *             See the License for the specific language governing permissions and
+ *             limitations under the License.
+ * @author: Marc Fischer <marc.fischer@isw.uni-stuttgart.de>
+ * @description: Native and encoded matrix multiplication C = A*B of row-major MxK and KxN matrices for arbitrary
+ *               sizes. The coding is selected by the definitions of coding_defines.h.
+ */
+#ifndef GEMM_H_
+#define GEMM_H_ 1
+
+#include <stddef.h>
+#include "coding_defines.h"
+
+// Tile sizes of gemm() and gemm_enc(), see gemm_tile.h
+#ifndef GEMM_MC
+#define GEMM_MC 32
+#endif
+#ifndef GEMM_NC
+#define GEMM_NC 64
+#endif
+#ifndef GEMM_KC
+#define GEMM_KC 128
+#endif
+
+// Initializes the coding of the kernels (AN64), has to be called before gemm_enc()
+void gemm_init(void);
+// Reference: naive i-j-k loop as mul100
+void gemm_ref(size_t m, size_t n, size_t k, const TEST_TYPE_U *a,
+	      const TEST_TYPE_U *b, TEST_TYPE_U *c);
+// Tiled kernels with the same blocking, the encoded one uses the operations of the coding
+void gemm(size_t m, size_t n, size_t k, const TEST_TYPE_U *a,
+	  const TEST_TYPE_U *b, TEST_TYPE_U *c);
+void gemm_enc(size_t m, size_t n, size_t k, const ENC_TYPE_U *a,
+	      const ENC_TYPE_U *b, ENC_TYPE_U *c);
+// Rows ic..ie-1 and columns jc..je-1 of C
+void gemm_tile(size_t n, size_t k, const TEST_TYPE_U *a, const TEST_TYPE_U *b,
+	       TEST_TYPE_U *c, size_t ic, size_t ie, size_t jc, size_t je);
+void gemm_enc_tile(size_t n, size_t k, const ENC_TYPE_U *a,
+		   const ENC_TYPE_U *b, ENC_TYPE_U *c, size_t ic, size_t ie,
+		   size_t jc, size_t je);
+
+#endif //GEMM_H_
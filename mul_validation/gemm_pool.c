@@ -0,0 +1,160 @@
+/**
+ * @copyright: (c) 2022, Institute for Control Engineering of Machine Tools and Manufacturing Units,
+ *             University of Stuttgart
+ *             All rights reserved. Licensed under the Apache License, Version 2.0 (the "License");
+ *             you may not use this file except in compliance with the License.
+ *             You may obtain a copy of the License at
+ *                  http://www.apache.org/licenses/LICENSE-2.0
+ *             Unless required by applicable law or agreed to in writing, software
+ *             distributed under the License is distributed on an "AS IS" BASIS,
+ *             WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *             See the License for the specific language governing permissions and
+ *             limitations under the License.
+ * @author: Marc Fischer <marc.fischer@isw.uni-stuttgart.de>
+ * @description: Thread pool of the parallel matrix multiplication
+ */
+#include "gemm_pool.h"
+#include "helpers.h"
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+struct gemm_worker {
+	gemm_pool_t *pool;
+	int index;
+	int core;
+	pthread_t thread;
+};
+
+struct gemm_pool {
+	pthread_mutex_t lock;
+	pthread_cond_t start;
+	pthread_cond_t done;
+	unsigned long generation; //Incremented for each job
+	int active; //Workers still working on the job
+	int stop;
+	gemm_pool_fn fn;
+	gemm_pool_worker_fn workerFn; //Set instead of fn for a job run once per worker
+	void *arg;
+	size_t tiles;
+	atomic_size_t next;
+	int threads;
+	struct gemm_worker *workers;
+};
+
+static void *gemm_pool_loop(void *data)
+{
+	struct gemm_worker *worker = data;
+	gemm_pool_t *pool = worker->pool;
+	unsigned long seen = 0;
+
+	schedutil_pinToCore(0, &worker->core, 1);
+	while (1) {
+		pthread_mutex_lock(&pool->lock);
+		while (pool->generation == seen && !pool->stop) {
+			pthread_cond_wait(&pool->start, &pool->lock);
+		}
+		if (pool->stop) {
+			pthread_mutex_unlock(&pool->lock);
+			return NULL;
+		}
+		seen = pool->generation;
+		pthread_mutex_unlock(&pool->lock);
+
+		if (pool->workerFn) {
+			pool->workerFn(pool->arg, worker->index);
+		} else {
+			size_t tile;
+			while ((tile = atomic_fetch_add(&pool->next, 1)) <
+			       pool->tiles) {
+				pool->fn(pool->arg, tile, worker->index);
+			}
+		}
+
+		pthread_mutex_lock(&pool->lock);
+		if (--pool->active == 0) {
+			pthread_cond_signal(&pool->done);
+		}
+		pthread_mutex_unlock(&pool->lock);
+	}
+}
+
+gemm_pool_t *gemm_pool_create(const int *coreList, int threads)
+{
+	gemm_pool_t *pool = calloc(1, sizeof(gemm_pool_t));
+	if (pool == NULL) {
+		return NULL;
+	}
+	pool->workers = calloc(threads, sizeof(struct gemm_worker));
+	if (pool->workers == NULL) {
+		free(pool);
+		return NULL;
+	}
+	pthread_mutex_init(&pool->lock, NULL);
+	pthread_cond_init(&pool->start, NULL);
+	pthread_cond_init(&pool->done, NULL);
+	for (int i = 0; i < threads; i++) {
+		pool->workers[i].pool = pool;
+		pool->workers[i].index = i;
+		pool->workers[i].core = coreList[i];
+		if (pthread_create(&pool->workers[i].thread, NULL,
+				   gemm_pool_loop, &pool->workers[i]) != 0) {
+			perror("[error] Could not create worker");
+			break;
+		}
+		pool->threads++;
+	}
+	if (pool->threads != threads) {
+		gemm_pool_destroy(pool);
+		return NULL;
+	}
+	return pool;
+}
+
+static void gemm_pool_dispatch(gemm_pool_t *pool, gemm_pool_fn fn,
+			    gemm_pool_worker_fn workerFn, void *arg,
+			    size_t tiles)
+{
+	pthread_mutex_lock(&pool->lock);
+	pool->fn = fn;
+	pool->workerFn = workerFn;
+	pool->arg = arg;
+	pool->tiles = tiles;
+	atomic_store(&pool->next, 0);
+	pool->active = pool->threads;
+	pool->generation++;
+	pthread_cond_broadcast(&pool->start);
+	while (pool->active > 0) {
+		pthread_cond_wait(&pool->done, &pool->lock);
+	}
+	pthread_mutex_unlock(&pool->lock);
+}
+
+void gemm_pool_run(gemm_pool_t *pool, gemm_pool_fn fn, void *arg,
+		   size_t tiles)
+{
+	gemm_pool_dispatch(pool, fn, NULL, arg, tiles);
+}
+
+void gemm_pool_run_workers(gemm_pool_t *pool, gemm_pool_worker_fn fn,
+			   void *arg)
+{
+	gemm_pool_dispatch(pool, NULL, fn, arg, 0);
+}
+
+void gemm_pool_destroy(gemm_pool_t *pool)
+{
+	pthread_mutex_lock(&pool->lock);
+	pool->stop = 1;
+	pthread_cond_broadcast(&pool->start);
+	pthread_mutex_unlock(&pool->lock);
+	for (int i = 0; i < pool->threads; i++) {
+		pthread_join(pool->workers[i].thread, NULL);
+	}
+	pthread_mutex_destroy(&pool->lock);
+	pthread_cond_destroy(&pool->start);
+	pthread_cond_destroy(&pool->done);
+	free(pool->workers);
+	free(pool);
+}
@@ -0,0 +1,38 @@
+/**
+ * @copyright: (c) 2022, Institute for Control Engineering of Machine Tools and Manufacturing Units,
+ *             University of Stuttgart
+ *             All rights reserved. Licensed under the Apache License, Version 2.0 (the "License");
+ *             you may not use this file except in compliance with the License.
+ *             You may obtain a copy of the License at
+ *                  http://www.apache.org/licenses/LICENSE-2.0
+ *             Unless required by applicable law or agreed to in writing, software
+ *             distributed under the License is distributed on an "AS IS" BASIS,
+ *             WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *             See the License for the specific language governing permissions and
+ *             limitations under the License.
+ * @author: Marc Fischer <marc.fischer@isw.uni-stuttgart.de>
+ * @description: Fixed pool of worker threads, each pinned to one core. A job is split into tiles, the workers
+ *               take the next tile until all tiles are done. A job can also run once on each worker, e.g. to
+ *               process the tiles a worker took in the job before.
+ */
+#ifndef GEMM_POOL_H_
+#define GEMM_POOL_H_ 1
+
+#include <stddef.h>
+
+// worker is the index of the calling worker in coreList
+typedef void (*gemm_pool_fn)(void *arg, size_t tile, int worker);
+typedef void (*gemm_pool_worker_fn)(void *arg, int worker);
+typedef struct gemm_pool gemm_pool_t;
+
+// Starts one worker per core of coreList. The workers inherit the scheduling of the calling thread.
+gemm_pool_t *gemm_pool_create(const int *coreList, int threads);
+// Calls fn(arg, tile, worker) for all tiles 0..tiles-1 and returns when all tiles are done
+void gemm_pool_run(gemm_pool_t *pool, gemm_pool_fn fn, void *arg,
+		   size_t tiles);
+// Calls fn(arg, worker) once on each worker and returns when all workers are done
+void gemm_pool_run_workers(gemm_pool_t *pool, gemm_pool_worker_fn fn,
+			   void *arg);
+void gemm_pool_destroy(gemm_pool_t *pool);
+
+#endif //GEMM_POOL_H_
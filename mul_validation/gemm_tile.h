@@ -0,0 +1,107 @@
+/**
+ * @copyright: (c) 2022, Institute for Control Engineering of Machine Tools and Manufacturing Units,
+ *             University of Stuttgart
+ *             All rights reserved. Licensed under the Apache License, Version 2.0 (the "License");
+ *             you may not use this file except in compliance with the License.
+ *             You may obtain a copy of the License at
+ *                  http://www.apache.org/licenses/LICENSE-2.0
+ *             Unless required by applicable law or agreed to in writing, software
+ *             distributed under the License is distributed on an "AS IS" BASIS,
+ *             WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *             See the License for the specific language governing permissions and
+ *             limitations under the License.
+ * @author: Marc Fischer <marc.fischer@isw.uni-stuttgart.de>
+ * @description: Generates the tiled matrix multiplication C = A*B for row-major MxK and KxN matrices.
+ *               GEMM_FN computes C, GEMM_TILE_FN one MCxNC tile of C. The names, the element type GEMM_T, the
+ *               zero GEMM_ZERO and the operations GEMM_ADD(s, x) and GEMM_MADD(s, x, y) (s + x*y) have to be
+ *               defined before the include. The header has no include guard and is included once for the
+ *               native and once for the encoded kernel, so both kernels share the same blocking.
+ *               Each tile is summed over blocks of KC, so the MCxKC block of A and the KCxNC block of B stay
+ *               in the cache. Inside a tile a 2x2 block of C is summed in registers, every loaded element of
+ *               A and B is used twice.
+ */
+
+#if !defined(GEMM_FN) || !defined(GEMM_TILE_FN) || !defined(GEMM_T) ||        \
+	!defined(GEMM_ZERO) || !defined(GEMM_ADD) || !defined(GEMM_MADD)
+#error "GEMM_FN, GEMM_TILE_FN, GEMM_T, GEMM_ZERO, GEMM_ADD and GEMM_MADD must be defined before including gemm_tile.h"
+#endif
+
+void GEMM_TILE_FN(size_t n, size_t k, const GEMM_T *a, const GEMM_T *b,
+		  GEMM_T *c, size_t ic, size_t ie, size_t jc, size_t je)
+{
+	const GEMM_T zero = GEMM_ZERO;
+
+	for (size_t i = ic; i < ie; i++) {
+		for (size_t j = jc; j < je; j++) {
+			c[i * n + j] = zero;
+		}
+	}
+	for (size_t pc = 0; pc < k; pc += GEMM_KC) {
+		size_t pe = GEMM_MINSIZE(pc + GEMM_KC, k);
+		size_t i = ic;
+		for (; i + 1 < ie; i += 2) {
+			const GEMM_T *a0 = &a[i * k];
+			const GEMM_T *a1 = &a[(i + 1) * k];
+			size_t j = jc;
+			for (; j + 1 < je; j += 2) {
+				GEMM_T s00 = zero, s01 = zero;
+				GEMM_T s10 = zero, s11 = zero;
+				for (size_t p = pc; p < pe; p++) {
+					GEMM_T b0 = b[p * n + j];
+					GEMM_T b1 = b[p * n + j + 1];
+					s00 = GEMM_MADD(s00, a0[p], b0);
+					s01 = GEMM_MADD(s01, a0[p], b1);
+					s10 = GEMM_MADD(s10, a1[p], b0);
+					s11 = GEMM_MADD(s11, a1[p], b1);
+				}
+				c[i * n + j] = GEMM_ADD(c[i * n + j], s00);
+				c[i * n + j + 1] = GEMM_ADD(c[i * n + j + 1], s01);
+				c[(i + 1) * n + j] =
+					GEMM_ADD(c[(i + 1) * n + j], s10);
+				c[(i + 1) * n + j + 1] =
+					GEMM_ADD(c[(i + 1) * n + j + 1], s11);
+			}
+			//Last column of an odd tile
+			for (; j < je; j++) {
+				GEMM_T s0 = zero, s1 = zero;
+				for (size_t p = pc; p < pe; p++) {
+					s0 = GEMM_MADD(s0, a0[p], b[p * n + j]);
+					s1 = GEMM_MADD(s1, a1[p], b[p * n + j]);
+				}
+				c[i * n + j] = GEMM_ADD(c[i * n + j], s0);
+				c[(i + 1) * n + j] =
+					GEMM_ADD(c[(i + 1) * n + j], s1);
+			}
+		}
+		//Last row of an odd tile
+		for (; i < ie; i++) {
+			for (size_t j = jc; j < je; j++) {
+				GEMM_T s0 = zero;
+				for (size_t p = pc; p < pe; p++) {
+					s0 = GEMM_MADD(s0, a[i * k + p],
+						       b[p * n + j]);
+				}
+				c[i * n + j] = GEMM_ADD(c[i * n + j], s0);
+			}
+		}
+	}
+}
+
+void GEMM_FN(size_t m, size_t n, size_t k, const GEMM_T *a, const GEMM_T *b,
+	     GEMM_T *c)
+{
+	for (size_t jc = 0; jc < n; jc += GEMM_NC) {
+		for (size_t ic = 0; ic < m; ic += GEMM_MC) {
+			GEMM_TILE_FN(n, k, a, b, c, ic,
+				     GEMM_MINSIZE(ic + GEMM_MC, m), jc,
+				     GEMM_MINSIZE(jc + GEMM_NC, n));
+		}
+	}
+}
+
+#undef GEMM_FN
+#undef GEMM_TILE_FN
+#undef GEMM_T
+#undef GEMM_ZERO
+#undef GEMM_ADD
+#undef GEMM_MADD
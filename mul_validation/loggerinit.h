@@ -20,12 +20,17 @@
 #include <string.h>
 #include <stdlib.h>
 
+// The tags can be defined before the include, each tag is evaluated from its start to its end
+#ifndef FOREACH_TAG
 #define FOREACH_TAG(TAG) TAG(TAG_PUT)
+#endif
+#define GENERATE_EVALPAIR(TAG) { TAG##_START, TAG##_END },
 
 enum TAG_ENUM { FOREACH_TAG(GENERATE_ENUM) TAG_COUNT };
 static const char *TAG_STRING[] = { FOREACH_TAG(GENERATE_TAGSTRINGS) };
 logger_tagDef_t *tagdef = NULL;
-logger_tagPair_t evalList[1] = { { TAG_PUT_START, TAG_PUT_END } };
+logger_tagPair_t evalList[] = { FOREACH_TAG(GENERATE_EVALPAIR) };
+#define EVAL_COUNT (sizeof(evalList) / sizeof(evalList[0]))
 static inline logger_tagDef_t *makeLoggerDef()
 {
 	logger_tagDef_t *def = malloc(sizeof(logger_tagDef_t[TAG_COUNT]));
@@ -0,0 +1,139 @@
+/**
+ * @copyright: (c) 2022, Institute for Control Engineering of Machine Tools and Manufacturing Units,
+ *             University of Stuttgart
+ *             All rights reserved. Licensed under the Apache License, Version 2.0 (the "License");
+ *             you may not use this file except in compliance with the License.
+ *             You may obtain a copy of the License at
+ *                  http://www.apache.org/licenses/LICENSE-2.0
+ *             Unless required by applicable law or agreed to in writing, software
+ *             distributed under the License is distributed on an "AS IS" BASIS,
+ *             WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *             See the License for the specific language governing permissions and
+ *             limitations under the License.
+ * @author: Marc Fischer <marc.fischer@isw.uni-stuttgart.de>
+ * @description: Validation of the deferred check. The AN encoded matrix multiplication is checked per value and
+ *               with checkpoints of different block lengths. Faults are injected into the input matrix to
+ *               measure the detection latency, i.e. the number of results computed after the first faulty
+ *               result until the fault is detected.
+ */
+#include "mul100.h"
+#include "mat.h"
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include "an_divfree_64.h"
+
+#define DATALEN 10000
+#define FAULTS 100
+
+// Same order as the tags
+static const int blockList[] = { MUL100_CHECK_NONE, MUL100_CHECK_VALUE,
+				 1, 10, 100, 1000, DATALEN };
+#define BLOCK_COUNT (sizeof(blockList) / sizeof(blockList[0]))
+
+uint64_t mA_e[DATALEN], mB_e[DATALEN], mC_e[DATALEN];
+uint64c1_t mA_c[DATALEN], mB_c[DATALEN], mC_c[DATALEN];
+
+void precomputation()
+{
+	for (int i = 0; i < DATALEN; i++) {
+		mA_e[i] = matA[i];
+		mB_e[i] = matB[i];
+		mA_c[i] = u_encode_64c1(matA[i]);
+		mB_c[i] = u_encode_64c1(matB[i]);
+	}
+}
+
+// Flips one bit of an input code word per run. A faulty A[i][k] corrupts the results C[i][0..99].
+void faultcampaign(const char *filename)
+{
+	FILE *f = fopen(filename, "w");
+	if (f == NULL) {
+		perror("fopen");
+		return;
+	}
+	fprintf(f, "BLOCK;FAULTS;DETECTED;LATENCY_MEAN;LATENCY_MAX\n");
+	for (unsigned int b = 0; b < BLOCK_COUNT; b++) {
+		int detected = 0;
+		int latencyMax = 0;
+		double latencySum = 0;
+		srand(1); //Same faults for each block length
+		for (int n = 0; n < FAULTS; n++) {
+			int pos = rand() % DATALEN;
+			//Code words are smaller than 2^80
+			uint64c1_t orig = mA_c[pos];
+			mA_c[pos] ^= (uint64c1_t)1 << (rand() % 80);
+			int r = mul100_an(mA_c, mB_c, mC_c, blockList[b]);
+			mA_c[pos] = orig;
+			if (r >= 0) {
+				int latency = r - (pos / 100) * 100;
+				detected++;
+				latencySum += latency;
+				if (latency > latencyMax) {
+					latencyMax = latency;
+				}
+			}
+		}
+		fprintf(f, "%d;%d;%d;%f;%d\n", blockList[b], FAULTS, detected,
+			detected ? latencySum / detected : 0.0, latencyMax);
+	}
+	fclose(f);
+}
+
+#ifdef DO_TIME_MEAS
+#define FOREACH_TAG(TAG)                                                       \
+	TAG(TAG_NOCHECK)                                                       \
+	TAG(TAG_VALUE)                                                         \
+	TAG(TAG_CKPT_1)                                                        \
+	TAG(TAG_CKPT_10)                                                       \
+	TAG(TAG_CKPT_100)                                                      \
+	TAG(TAG_CKPT_1000)                                                     \
+	TAG(TAG_CKPT_10000)
+#include "logger.h"
+#include "loggerinit.h"
+#include "helpers.h"
+#include "string.h"
+#endif
+
+int main(void)
+{
+#ifdef DO_TIME_MEAS
+	log_init();
+	int coreList = 3;
+	schedutil_pinToCore(0, &coreList, 1);
+	schedutil_sched_setFIFO(0, 99);
+#endif
+
+	precomputation();
+
+#ifdef DO_TIME_MEAS
+	//The logger holds 2000 entries. The start and end tag of a block length follow each other.
+	for (unsigned int b = 0; b < BLOCK_COUNT; b++) {
+		for (int i = 0; i < 100; i++) {
+			logger_addLogEntry(TAG_NOCHECK_START + 2 * b, i, 0);
+			mul100_an(mA_c, mB_c, mC_c, blockList[b]);
+			logger_addLogEntry(TAG_NOCHECK_END + 2 * b, i, 0);
+		}
+	}
+	logger_evaluate(evalList, EVAL_COUNT, tagdef, TAG_COUNT,
+			"mul100-ckpt.csv");
+	logger_clear();
+#endif
+
+	faultcampaign("mul100-ckpt-latency.csv");
+
+	printf("[Info] Result:");
+	if (mul100_an(mA_c, mB_c, mC_c, MUL100_CHECK_VALUE) >= 0) {
+		printf("FAULT\n");
+		return 2;
+	}
+	mul100(mA_e, mB_e, mC_e);
+	for (int i = 0; i < DATALEN; i++) {
+		if (mC_e[i] != u_decode_64c1(mC_c[i])) {
+			printf("ERROR\n");
+			return 1;
+		}
+	}
+	printf("GOOD\n");
+	return 0;
+}
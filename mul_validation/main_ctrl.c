@@ -0,0 +1,197 @@
+/**
+ * @copyright: (c) 2022, Institute for Control Engineering of Machine Tools and Manufacturing Units,
+ *             University of Stuttgart
+ *             All rights reserved. Licensed under the Apache License, Version 2.0 (the "License");
+ *             you may not use this file except in compliance with the License.
+ *             You may obtain a copy of the License at
+ *                  http://www.apache.org/licenses/LICENSE-2.0
+ *             Unless required by applicable law or agreed to in writing, software
+ *             distributed under the License is distributed on an "AS IS" BASIS,
+ *             WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *             See the License for the specific language governing permissions and
+ *             limitations under the License.
+ * @author: Marc Fischer <marc.fischer@isw.uni-stuttgart.de>
+ * @description: Validation of the encoded control kernels. Usage: val-ctrl-<coding> [N]
+ *               Each kernel of ctrl.h runs native and encoded on N samples (default 1000), the decoded results
+ *               have to be equal to the native ones. With DO_TIME_MEAS each kernel is timed CTRL_RUNS times.
+ */
+#include "ctrl.h"
+#include "helpers.h"
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+
+#define CTRL_RUNS 100
+// Samples of one period of the acceleration profile
+#define CTRL_ACC_PERIOD 1024
+
+#ifdef DO_TIME_MEAS
+#define FOREACH_TAG(TAG)                                                       \
+	TAG(TAG_PID)                                                           \
+	TAG(TAG_PID_ENC)                                                       \
+	TAG(TAG_FIR)                                                           \
+	TAG(TAG_FIR_ENC)                                                       \
+	TAG(TAG_IIR)                                                           \
+	TAG(TAG_IIR_ENC)                                                       \
+	TAG(TAG_LIN)                                                           \
+	TAG(TAG_LIN_ENC)                                                       \
+	TAG(TAG_CIRC)                                                          \
+	TAG(TAG_CIRC_ENC)                                                      \
+	TAG(TAG_RAMP)                                                          \
+	TAG(TAG_RAMP_ENC)                                                      \
+	TAG(TAG_CYCLE)                                                         \
+	TAG(TAG_CYCLE_ENC)
+#include "logger.h"
+#include "loggerinit.h"
+#include "string.h"
+#define CTRL_MEAS(TAG, call)                                                   \
+	for (int r = 0; r < CTRL_RUNS; r++) {                                  \
+		logger_addLogEntry(TAG##_START, r, 0);                         \
+		call;                                                          \
+		logger_addLogEntry(TAG##_END, r, 0);                           \
+	}
+#else
+#define CTRL_MEAS(TAG, call) call
+#endif
+
+// Inputs and results of all kernels, native and encoded
+typedef struct {
+	TEST_TYPE *sp, *meas, *acc, *p, *tmp, *out, *px, *py;
+	ENC_TYPE *sp_c, *meas_c, *acc_c, *p_c, *tmp_c, *out_c, *px_c, *py_c;
+} ctrl_data_t;
+
+static ENC_TYPE *encodeAll(const TEST_TYPE *x, size_t n)
+{
+	ENC_TYPE *x_c = malloc(n * sizeof(ENC_TYPE));
+	for (size_t i = 0; x_c && i < n; i++) {
+		x_c[i] = ENCODEDFUNCTION(encode)(x[i]);
+	}
+	return x_c;
+}
+
+// Number of results of x_c whose decoded value differs from x
+static size_t compare(const TEST_TYPE *x, const ENC_TYPE *x_c, size_t n)
+{
+	size_t errors = 0;
+	for (size_t i = 0; i < n; i++) {
+		errors += ENCODEDFUNCTION(decode)(x_c[i]) != x[i];
+	}
+	return errors;
+}
+
+static int report(const char *kernel, size_t errors)
+{
+	printf("[Info] Result " ENCODING_NAME " %s:%s\n", kernel,
+	       errors ? "ERROR" : "GOOD");
+	return errors != 0;
+}
+
+int main(int argc, char *argv[])
+{
+	size_t n = 1000;
+	if (argc >= 2) {
+		n = strtoul(argv[1], NULL, 10);
+	}
+	if (n > CTRL_MAX_N) {
+		printf("[Error] N has to be at most %d\n", CTRL_MAX_N);
+		return 1;
+	}
+	ctrl_init();
+#ifdef DO_TIME_MEAS
+	tagdef = makeLoggerDef();
+	logger_config_t config = { LCLOCK_LINUX_REALTIME, 1,
+				   CTRL_RUNS * TAG_COUNT };
+	logger_init(config);
+	int coreList = 3;
+	schedutil_pinToCore(0, &coreList, 1);
+	schedutil_sched_setFIFO(0, 99);
+#endif
+
+	ctrl_data_t d;
+	d.sp = malloc(n * sizeof(TEST_TYPE));
+	d.meas = malloc(n * sizeof(TEST_TYPE));
+	d.acc = malloc(n * sizeof(TEST_TYPE));
+	d.p = malloc(4 * sizeof(TEST_TYPE));
+	d.tmp = malloc(2 * n * sizeof(TEST_TYPE));
+	d.out = malloc(n * sizeof(TEST_TYPE));
+	d.px = malloc(n * sizeof(TEST_TYPE));
+	d.py = malloc(n * sizeof(TEST_TYPE));
+	d.tmp_c = malloc(2 * n * sizeof(ENC_TYPE));
+	d.out_c = malloc(n * sizeof(ENC_TYPE));
+	d.px_c = malloc(n * sizeof(ENC_TYPE));
+	d.py_c = malloc(n * sizeof(ENC_TYPE));
+	if (!d.sp || !d.meas || !d.acc || !d.p || !d.tmp || !d.out || !d.px ||
+	    !d.py || !d.tmp_c || !d.out_c || !d.px_c || !d.py_c) {
+		printf("[Error] Out of memory\n");
+		return 1;
+	}
+
+	//12 bit sensor values: the setpoint is a triangle, the measurement follows it with noise. The acceleration
+	//profile of the ramp moves forward and back within CTRL_ACC_PERIOD samples: accelerate, coast, brake and the
+	//same backwards. The position returns to 0 each period, so it stays bounded for any n.
+	for (size_t i = 0; i < n; i++) {
+		TEST_TYPE tri = (TEST_TYPE)(i % 512);
+		size_t phase = i % CTRL_ACC_PERIOD / (CTRL_ACC_PERIOD / 8);
+		d.sp[i] = ((i / 512) % 2 ? 511 - tri : tri) * 8 - 2048;
+		d.meas[i] = d.sp[i] + (TEST_TYPE)(getInt32Rand() % 64) - 32;
+		d.acc[i] = 0;
+		if (phase == 0 || phase == 6) {
+			d.acc[i] = 8;
+		} else if (phase == 2 || phase == 4) {
+			d.acc[i] = -8;
+		}
+	}
+	d.p[0] = 100;
+	d.p[1] = -200;
+	d.p[2] = 3000;
+	d.p[3] = 1500;
+	const TEST_TYPE radius = 2048;
+	d.sp_c = encodeAll(d.sp, n);
+	d.meas_c = encodeAll(d.meas, n);
+	d.acc_c = encodeAll(d.acc, n);
+	d.p_c = encodeAll(d.p, 4);
+	if (!d.sp_c || !d.meas_c || !d.acc_c || !d.p_c) {
+		printf("[Error] Out of memory\n");
+		return 1;
+	}
+	const ENC_TYPE radius_c = ENCODEDFUNCTION(encode)(radius);
+
+	int ret = 0;
+	CTRL_MEAS(TAG_PID, ctrl_pid(n, d.sp, d.meas, d.out));
+	CTRL_MEAS(TAG_PID_ENC, ctrl_enc_pid(n, d.sp_c, d.meas_c, d.out_c));
+	ret |= report("pid", compare(d.out, d.out_c, n));
+
+	CTRL_MEAS(TAG_FIR, ctrl_fir(n, d.meas, d.out));
+	CTRL_MEAS(TAG_FIR_ENC, ctrl_enc_fir(n, d.meas_c, d.out_c));
+	ret |= report("fir", compare(d.out, d.out_c, n));
+
+	CTRL_MEAS(TAG_IIR, ctrl_iir(n, d.meas, d.out));
+	CTRL_MEAS(TAG_IIR_ENC, ctrl_enc_iir(n, d.meas_c, d.out_c));
+	ret |= report("iir", compare(d.out, d.out_c, n));
+
+	CTRL_MEAS(TAG_LIN, ctrl_lin(n, d.p, d.px, d.py));
+	CTRL_MEAS(TAG_LIN_ENC, ctrl_enc_lin(n, d.p_c, d.px_c, d.py_c));
+	ret |= report("lin",
+		      compare(d.px, d.px_c, n) + compare(d.py, d.py_c, n));
+
+	CTRL_MEAS(TAG_CIRC, ctrl_circ(n, radius, d.px, d.py));
+	CTRL_MEAS(TAG_CIRC_ENC, ctrl_enc_circ(n, radius_c, d.px_c, d.py_c));
+	ret |= report("circ",
+		      compare(d.px, d.px_c, n) + compare(d.py, d.py_c, n));
+
+	CTRL_MEAS(TAG_RAMP, ctrl_ramp(n, d.acc, d.out));
+	CTRL_MEAS(TAG_RAMP_ENC, ctrl_enc_ramp(n, d.acc_c, d.out_c));
+	ret |= report("ramp", compare(d.out, d.out_c, n));
+
+	CTRL_MEAS(TAG_CYCLE, ctrl_cycle(n, d.acc, d.meas, d.tmp, d.out));
+	CTRL_MEAS(TAG_CYCLE_ENC,
+		  ctrl_enc_cycle(n, d.acc_c, d.meas_c, d.tmp_c, d.out_c));
+	ret |= report("cycle", compare(d.out, d.out_c, n));
+
+#ifdef DO_TIME_MEAS
+	char bufname[200];
+	sprintf(bufname, "ctrl_%s.csv", ENCODING_NAME);
+	logger_evaluate(evalList, EVAL_COUNT, tagdef, TAG_COUNT, bufname);
+#endif
+	return ret;
+}
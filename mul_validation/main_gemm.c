@@ -0,0 +1,254 @@
+/**
+ * @copyright: (c) 2022, Institute for Control Engineering of Machine Tools and Manufacturing Units,
+ *             University of Stuttgart
+ *             All rights reserved. Licensed under the Apache License, Version 2.0 (the "License");
+ *             you may not use this file except in compliance with the License.
+ *             You may obtain a copy of the License at
+ *                  http://www.apache.org/licenses/LICENSE-2.0
+ *             Unless required by applicable law or agreed to in writing, software
+ *             distributed under the License is distributed on an "AS IS" BASIS,
+ *             WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *             See the License for the specific language governing permissions and
+ *             limitations under the License.
+ * @author: Marc Fischer <marc.fischer@isw.uni-stuttgart.de>
+ * @description: Validation of the tiled encoded matrix multiplication. Usage: val-gemm-<coding> [M N K [THREADS]]
+ *               The sizes default to the 100x100 matrices of mul100. With THREADS the tiles of C are computed
+ *               by a pool of 1..THREADS pinned workers. Each worker records the tiles it computed in the encoded
+ *               job and after the timed job checks the decoded results of these tiles against the native job, as
+ *               the postcomputation of val-mul-enc.
+ */
+#include "gemm.h"
+#include "gemm_pool.h"
+#include "helpers.h"
+#include <stdatomic.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <unistd.h>
+
+#ifdef DO_TIME_MEAS
+#define FOREACH_TAG(TAG)                                                       \
+	TAG(TAG_REF)                                                           \
+	TAG(TAG_NATIVE)                                                        \
+	TAG(TAG_ENC)                                                           \
+	TAG(TAG_MT_NATIVE)                                                     \
+	TAG(TAG_MT_ENC)
+#include "logger.h"
+#include "loggerinit.h"
+#include "string.h"
+// Index of TAG_MT_NATIVE in evalList
+#define EVAL_MT 3
+#endif
+
+struct gemm_job {
+	size_t m, n, k;
+	const TEST_TYPE_U *a, *b;
+	TEST_TYPE_U *c;
+	const ENC_TYPE_U *a_c, *b_c;
+	ENC_TYPE_U *c_c;
+	size_t tiles;
+	int *owner; //Worker that computed the tile in the encoded job
+	atomic_int faults;
+};
+
+// Tile t covers GEMM_MC rows and GEMM_NC columns of C, the tiles are numbered row by row
+static void gemm_job_bounds(const struct gemm_job *job, size_t tile,
+			    size_t *ic, size_t *ie, size_t *jc, size_t *je)
+{
+	size_t tilesN = (job->n + GEMM_NC - 1) / GEMM_NC;
+	*ic = tile / tilesN * GEMM_MC;
+	*jc = tile % tilesN * GEMM_NC;
+	*ie = *ic + GEMM_MC < job->m ? *ic + GEMM_MC : job->m;
+	*je = *jc + GEMM_NC < job->n ? *jc + GEMM_NC : job->n;
+}
+
+static void gemm_job_native(void *arg, size_t tile, int worker)
+{
+	(void)worker;
+	struct gemm_job *job = arg;
+	size_t ic, ie, jc, je;
+	gemm_job_bounds(job, tile, &ic, &ie, &jc, &je);
+	gemm_tile(job->n, job->k, job->a, job->b, job->c, ic, ie, jc, je);
+}
+
+static void gemm_job_enc(void *arg, size_t tile, int worker)
+{
+	struct gemm_job *job = arg;
+	size_t ic, ie, jc, je;
+	gemm_job_bounds(job, tile, &ic, &ie, &jc, &je);
+	gemm_enc_tile(job->n, job->k, job->a_c, job->b_c, job->c_c, ic, ie, jc,
+		      je);
+	job->owner[tile] = worker;
+}
+
+// Each worker compares the decoded results of the tiles it computed in the encoded job with the native job.
+// Runs after the timed encoded job, so the check is not part of the timing.
+static void gemm_job_check(void *arg, int worker)
+{
+	struct gemm_job *job = arg;
+	for (size_t tile = 0; tile < job->tiles; tile++) {
+		if (job->owner[tile] != worker) {
+			continue;
+		}
+		size_t ic, ie, jc, je;
+		gemm_job_bounds(job, tile, &ic, &ie, &jc, &je);
+		for (size_t i = ic; i < ie; i++) {
+			for (size_t j = jc; j < je; j++) {
+				if (ENCODEDFUNCTION_U(decode)(
+					    job->c_c[i * job->n + j]) !=
+				    job->c[i * job->n + j]) {
+					atomic_fetch_add(&job->faults, 1);
+				}
+			}
+		}
+	}
+}
+
+// Runs the native and the encoded job with 1..threads workers
+static int gemm_scaling(struct gemm_job *job, const TEST_TYPE_U *ref,
+			int threads)
+{
+	size_t tiles = ((job->m + GEMM_MC - 1) / GEMM_MC) *
+		       ((job->n + GEMM_NC - 1) / GEMM_NC);
+	long cores = sysconf(_SC_NPROCESSORS_ONLN);
+	int *coreList = malloc(threads * sizeof(int));
+	job->tiles = tiles;
+	job->owner = malloc(tiles * sizeof(int));
+	if (!coreList || !job->owner) {
+		printf("[Error] Out of memory\n");
+		free(coreList);
+		free(job->owner);
+		return 1;
+	}
+	int ret = 0;
+	for (int i = 0; i < threads; i++) {
+		coreList[i] = i % cores;
+	}
+
+	for (int t = 1; t <= threads; t++) {
+		gemm_pool_t *pool = gemm_pool_create(coreList, t);
+		if (pool == NULL) {
+			printf("[Error] Could not start %d workers\n", t);
+			ret = 1;
+			break;
+		}
+		atomic_store(&job->faults, 0);
+#ifdef DO_TIME_MEAS
+		for (int i = 0; i < 100; i++) {
+			logger_addLogEntry(TAG_MT_NATIVE_START, i, 0);
+			gemm_pool_run(pool, gemm_job_native, job, tiles);
+			logger_addLogEntry(TAG_MT_NATIVE_END, i, 0);
+			logger_addLogEntry(TAG_MT_ENC_START, i, 0);
+			gemm_pool_run(pool, gemm_job_enc, job, tiles);
+			logger_addLogEntry(TAG_MT_ENC_END, i, 0);
+			gemm_pool_run_workers(pool, gemm_job_check, job);
+		}
+		char bufname[200];
+		sprintf(bufname, "gemm_mt_%s_%d.csv", ENCODING_NAME, t);
+		logger_evaluate(&evalList[EVAL_MT], 2, tagdef, TAG_COUNT,
+				bufname);
+		logger_clear();
+#else
+		gemm_pool_run(pool, gemm_job_native, job, tiles);
+		gemm_pool_run(pool, gemm_job_enc, job, tiles);
+		gemm_pool_run_workers(pool, gemm_job_check, job);
+#endif
+		gemm_pool_destroy(pool);
+
+		int good = atomic_load(&job->faults) == 0;
+		for (size_t i = 0; good && i < job->m * job->n; i++) {
+			good = job->c[i] == ref[i];
+		}
+		printf("[Info] Result %d threads:%s\n", t, good ? "GOOD" : "ERROR");
+		if (!good) {
+			ret = 1;
+		}
+	}
+	free(coreList);
+	free(job->owner);
+	return ret;
+}
+
+int main(int argc, char *argv[])
+{
+	size_t m = 100, n = 100, k = 100;
+	int threads = 0;
+	if (argc >= 4) {
+		m = strtoul(argv[1], NULL, 10);
+		n = strtoul(argv[2], NULL, 10);
+		k = strtoul(argv[3], NULL, 10);
+	}
+	if (argc >= 5) {
+		threads = atoi(argv[4]);
+	}
+#ifdef AN64
+	init();
+#endif
+	gemm_init();
+#ifdef DO_TIME_MEAS
+	log_init();
+	int coreList = 3;
+	schedutil_pinToCore(0, &coreList, 1);
+	schedutil_sched_setFIFO(0, 99);
+#endif
+
+	TEST_TYPE_U *mA = malloc(m * k * sizeof(TEST_TYPE_U));
+	TEST_TYPE_U *mB = malloc(k * n * sizeof(TEST_TYPE_U));
+	TEST_TYPE_U *mC = malloc(m * n * sizeof(TEST_TYPE_U));
+	TEST_TYPE_U *mC_e = malloc(m * n * sizeof(TEST_TYPE_U));
+	ENC_TYPE_U *mA_c = malloc(m * k * sizeof(ENC_TYPE_U));
+	ENC_TYPE_U *mB_c = malloc(k * n * sizeof(ENC_TYPE_U));
+	ENC_TYPE_U *mC_c = malloc(m * n * sizeof(ENC_TYPE_U));
+	if (!mA || !mB || !mC || !mC_e || !mA_c || !mB_c || !mC_c) {
+		printf("[Error] Out of memory\n");
+		return 1;
+	}
+
+	for (size_t i = 0; i < m * k; i++) {
+		mA[i] = (TEST_TYPE_U)getInt64Rand();
+		mA_c[i] = ENCODEDFUNCTION_U(encode)(mA[i]);
+	}
+	for (size_t i = 0; i < k * n; i++) {
+		mB[i] = (TEST_TYPE_U)getInt64Rand();
+		mB_c[i] = ENCODEDFUNCTION_U(encode)(mB[i]);
+	}
+
+#ifdef DO_TIME_MEAS
+	for (int i = 0; i < 100; i++) {
+		logger_addLogEntry(TAG_REF_START, i, 0);
+		gemm_ref(m, n, k, mA, mB, mC_e);
+		logger_addLogEntry(TAG_REF_END, i, 0);
+		logger_addLogEntry(TAG_NATIVE_START, i, 0);
+		gemm(m, n, k, mA, mB, mC);
+		logger_addLogEntry(TAG_NATIVE_END, i, 0);
+		logger_addLogEntry(TAG_ENC_START, i, 0);
+		gemm_enc(m, n, k, mA_c, mB_c, mC_c);
+		logger_addLogEntry(TAG_ENC_END, i, 0);
+	}
+	char bufname[200];
+	sprintf(bufname, "gemm_%s.csv", ENCODING_NAME);
+	logger_evaluate(evalList, EVAL_MT, tagdef, TAG_COUNT, bufname);
+	logger_clear();
+#else
+	gemm_ref(m, n, k, mA, mB, mC_e);
+	gemm(m, n, k, mA, mB, mC);
+	gemm_enc(m, n, k, mA_c, mB_c, mC_c);
+#endif
+
+	printf("[Info] Result " ENCODING_NAME " %zux%zux%zu:", m, n, k);
+	for (size_t i = 0; i < m * n; i++) {
+		if (mC[i] != mC_e[i] ||
+		    ENCODEDFUNCTION_U(decode)(mC_c[i]) != mC_e[i]) {
+			printf("ERROR\n");
+			return 1;
+		}
+	}
+	printf("GOOD\n");
+
+	if (threads > 0) {
+		struct gemm_job job = { m, n, k, mA, mB, mC, mA_c, mB_c, mC_c,
+					0, NULL, 0 };
+		return gemm_scaling(&job, mC_e, threads);
+	}
+	return 0;
+}
@@ -20,4 +20,11 @@
 void mul100(uint64_t *matA, uint64_t *matB, uint64_t *matC);
 void mul100_enc(uint64_t *matA, uint64_t *matB, uint64_t *matC);
 
+// Check of the results of mul100_an: none, each value or a checkpoint after block values (block > 0)
+#define MUL100_CHECK_NONE -1
+#define MUL100_CHECK_VALUE 0
+// Returns the index of the result at which a fault is detected, -1 if all checks passed
+int mul100_an(const __uint128_t *matA, const __uint128_t *matB,
+	      __uint128_t *matC, int block);
+
 #endif
\ No newline at end of file
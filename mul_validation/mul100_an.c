@@ -0,0 +1,74 @@
+/**
+ * @copyright: (c) 2022, Institute for Control Engineering of Machine Tools and Manufacturing Units,
+ *             University of Stuttgart
+ *             All rights reserved. Licensed under the Apache License, Version 2.0 (the "License");
+ *             you may not use this file except in compliance with the License.
+ *             You may obtain a copy of the License at
+ *                  http://www.apache.org/licenses/LICENSE-2.0
+ *             Unless required by applicable law or agreed to in writing, software
+ *             distributed under the License is distributed on an "AS IS" BASIS,
+ *             WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *             See the License for the specific language governing permissions and
+ *             limitations under the License.
+ * @author: Marc Fischer <marc.fischer@isw.uni-stuttgart.de>
+ * @description: AN encoded matrix multiplication with per value or deferred (checkpoint) checking of the results
+ */
+#include "an_divfree_64.h"
+#include "mul100.h"
+#include <stdint.h>
+
+int mul100_an(const uint64c1_t *matA, const uint64c1_t *matB,
+	      uint64c1_t *matC, int block)
+{
+	const uint64c1_t one_c1 = u_encode_64c1(1);
+	const uint64c1_t dim_c1 = u_encode_64c1(100);
+	ckpt_64c1_t sig;
+	int open = 0;
+
+	ckpt_init_64c1(&sig);
+	for (uint64c1_t i = u_encode_64c1(0);
+	     u_decode_64c1(u_less_64c1(i, dim_c1)); i = u_add_64c1(i, one_c1)) {
+		for (uint64c1_t j = u_encode_64c1(0);
+		     u_decode_64c1(u_less_64c1(j, dim_c1));
+		     j = u_add_64c1(j, one_c1)) {
+			uint64c1_t sumVal = u_encode_64c1(0);
+			for (uint64c1_t k = u_encode_64c1(0);
+			     u_decode_64c1(u_less_64c1(k, dim_c1));
+			     k = u_add_64c1(k, one_c1)) {
+				sumVal = u_add_64c1(
+					sumVal,
+					u_mul_64c1(
+						matA[u_decode_64c1(u_add_64c1(
+							u_mul_64c1(i, dim_c1),
+							k))],
+						matB[u_decode_64c1(u_add_64c1(
+							u_mul_64c1(k, dim_c1),
+							j))]));
+			}
+
+			int idx = u_decode_64c1(
+				u_add_64c1(u_mul_64c1(i, dim_c1), j));
+			matC[idx] = sumVal;
+
+			if (block == MUL100_CHECK_VALUE) {
+				if (!u_divisible_64c1(sumVal)) {
+					return idx;
+				}
+			} else if (block > 0) {
+				u_ckpt_add_64c1(&sig, sumVal);
+				if (++open == block) {
+					if (!ckpt_verify_64c1(&sig)) {
+						return idx;
+					}
+					ckpt_init_64c1(&sig);
+					open = 0;
+				}
+			}
+		}
+	}
+	//Last, incomplete block
+	if (open && !ckpt_verify_64c1(&sig)) {
+		return 100 * 100 - 1;
+	}
+	return -1;
+}
@@ -0,0 +1,131 @@
+# @copyright: (c) 2022, Institute for Control Engineering of Machine Tools and Manufacturing Units,
+#             University of Stuttgart
+#             All rights reserved. Licensed under the Apache License, Version 2.0 (the "License");
+#             you may not use this file except in compliance with the License.
+#             You may obtain a copy of the License at
+#                  http://www.apache.org/licenses/LICENSE-2.0
+#             Unless required by applicable law or agreed to in writing, software
+#             distributed under the License is distributed on an "AS IS" BASIS,
+#             WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#             See the License for the specific language governing permissions and
+#             limitations under the License.
+# @author: Marc Fischer <marc.fischer@isw.uni-stuttgart.de>
+# @description: Compares two result records (result_*.json) of the benchmark. Each coding, operation and mode
+#               of both runs is compared by the ratio of the medians of its samples and a two sided
+#               Mann-Whitney U test. A change is significant if its Holm corrected p-value is below alpha and
+#               the ratio differs from 1 by more than the threshold. The exit code is 1 if a regression was
+#               found, so the script can be used to check changes of the coding headers.
+#               Usage: python compareRuns.py [-a alpha] [-t threshold] [-e codings] [--all] old.json new.json
+import argparse
+import json
+import math
+import sys
+
+
+def median(values):
+    values = sorted(values)
+    n = len(values)
+    return (values[(n - 1) // 2] + values[n // 2]) / 2
+
+
+def mannWhitney(x, y):
+    """Two sided p-value of the Mann-Whitney U test with the normal approximation and tie correction"""
+    n1, n2 = len(x), len(y)
+    if n1 == 0 or n2 == 0:
+        return 1.0
+    ranked = sorted([(v, 0) for v in x] + [(v, 1) for v in y])
+    rankSum = 0.0
+    ties = 0.0
+    i = 0
+    while i < len(ranked):
+        j = i
+        while j < len(ranked) and ranked[j][0] == ranked[i][0]:
+            j += 1
+        # Mean rank of the tied values i..j-1, ranks start at 1
+        rank = (i + j + 1) / 2
+        rankSum += rank * sum(1 for k in range(i, j) if ranked[k][1] == 0)
+        ties += (j - i) ** 3 - (j - i)
+        i = j
+    u = rankSum - n1 * (n1 + 1) / 2
+    n = n1 + n2
+    sigma = math.sqrt(n1 * n2 / 12 * ((n + 1) - ties / (n * (n - 1))))
+    if sigma == 0:
+        return 1.0
+    z = (abs(u - n1 * n2 / 2) - 0.5) / sigma
+    return math.erfc(max(z, 0) / math.sqrt(2))
+
+
+def holm(pvalues):
+    """Holm corrected p-values in the order of pvalues"""
+    order = sorted(range(len(pvalues)), key=lambda i: pvalues[i])
+    corrected = [1.0] * len(pvalues)
+    running = 0.0
+    for rank, i in enumerate(order):
+        running = max(running, min(1.0, (len(pvalues) - rank) * pvalues[i]))
+        corrected[i] = running
+    return corrected
+
+
+def loadRecord(filename):
+    with open(filename) as f:
+        record = json.load(f)
+    if record.get('format') != 'acbench':
+        sys.exit('%s is not a result record of the benchmark' % filename)
+    return record
+
+
+def compareMetadata(old, new):
+    """Prints the host, build and run parameters that differ, timings of different setups are not comparable"""
+    for section in ('host', 'build', 'run'):
+        for key in sorted(set(old[section]) | set(new[section])):
+            if key in ('date', 'seed', 'commit'):
+                continue
+            a, b = old[section].get(key), new[section].get(key)
+            if a != b:
+                print('[Warning] %s.%s differs: %s -> %s' % (section, key, a, b))
+    print('commit %s -> %s' % (old['build'].get('commit'), new['build'].get('commit')))
+
+
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser(description='Compares two result records of the benchmark')
+    parser.add_argument('old')
+    parser.add_argument('new')
+    parser.add_argument('-a', '--alpha', type=float, default=0.05, help='significance level')
+    parser.add_argument('-t', '--threshold', type=float, default=0.02,
+                        help='smallest relevant change of the median, e.g. 0.02 for 2%%')
+    parser.add_argument('-e', '--codings', help='comma separated list of codings, default all')
+    parser.add_argument('--all', action='store_true', help='print all operations, not only the changes')
+    args = parser.parse_args()
+
+    old = loadRecord(args.old)
+    new = loadRecord(args.new)
+    compareMetadata(old, new)
+    codings = args.codings.split(',') if args.codings else None
+
+    def key(result):
+        return (result['coding'], result['operation'], result['mode'])
+    oldResults = {key(r): r for r in old['results'] if r['samples']}
+    rows = []
+    for result in new['results']:
+        k = key(result)
+        if k not in oldResults or not result['samples']:
+            continue
+        if codings and k[0] not in codings:
+            continue
+        a, b = oldResults[k]['samples'], result['samples']
+        rows.append([k, median(a), median(b), median(b) / median(a), mannWhitney(a, b)])
+    for row, p in zip(rows, holm([row[4] for row in rows])):
+        row[4] = p
+
+    regressions = 0
+    print('%-14s %-10s %-4s %12s %12s %8s %10s' % ('CODING', 'OPERATION', 'MODE', 'OLD_NS', 'NEW_NS', 'RATIO', 'P_HOLM'))
+    for (coding, op, mode), a, b, ratio, p in sorted(rows):
+        significant = p < args.alpha and abs(ratio - 1) > args.threshold
+        flag = ''
+        if significant:
+            flag = 'REGRESSION' if ratio > 1 else 'improvement'
+            regressions += ratio > 1
+        if significant or args.all:
+            print('%-14s %-10s %-4s %12.4f %12.4f %8.3f %10.2g %s' % (coding, op, mode, a, b, ratio, p, flag))
+    print('%d of %d operations compared, %d regressions' % (len(rows), len(oldResults), regressions))
+    sys.exit(1 if regressions else 0)
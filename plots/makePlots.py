@@ -18,21 +18,42 @@ from matplotlib.ticker import ScalarFormatter
 import pandas as pd
 import os
 import re
+import numpy as np
 from common import *
 
+# Coding names of the benchmark driver
+CODING_OF = {'NONE_32BIT': 'none32', 'NONE_64BIT': 'none64', 'AN_32BIT': 'an32', 'AN_64BIT': 'an64',
+             'ONES_COMPLEMENT_32BIT': 'onecmp32', 'ONES_COMPLEMENT_64BIT': 'onecmp64',
+             'TWOS_COMPLEMENT_32BIT': 'twocmp32', 'TWOS_COMPLEMENT_64BIT': 'twocmp64',
+             'RESIDUE_32BIT': 'res32', 'RESIDUE_64BIT': 'res64'}
+
+def readPerf(path, fl):
+    # Timings of one encoding, either from the combined perf_all.csv or an old perf_<encoding>.csv
+    allFile = os.path.join(path, 'perf_all.csv')
+    if not os.path.exists(allFile):
+        return pd.read_csv(os.path.join(path, fl), delimiter=';')
+    coding = CODING_OF[re.search(r'perf_([\w_\d]+).csv', fl).group(1)]
+    # Timings only, the hardware counters follow MEDIAN
+    df = pd.read_csv(allFile, delimiter=';')
+    df = df[['TAGS', 'COUNT', 'MIN', 'MAX', 'AVG', 'MEDIAN']]
+    # Throughput only, the latency is tagged with _LAT. TAG_EMPTY is the calibration loop.
+    df = df[df['TAGS'].str.startswith(coding + ':') &
+            ~df['TAGS'].str.contains('_LAT_START') &
+            ~df['TAGS'].str.contains(':TAG_EMPTY_')].reset_index(drop=True)
+    df['TAGS'] = df['TAGS'].str.replace(coding + ':', '', regex=False)
+    return df
+
 def readData(path):
     fileList32 = ['perf_AN_32BIT.csv', 'perf_ONES_COMPLEMENT_32BIT.csv',
               'perf_TWOS_COMPLEMENT_32BIT.csv', 'perf_RESIDUE_32BIT.csv']
     fileList64 = ['perf_AN_64BIT.csv', 'perf_ONES_COMPLEMENT_64BIT.csv',
                 'perf_TWOS_COMPLEMENT_64BIT.csv', 'perf_RESIDUE_64BIT.csv']
-    dfnone32 = pd.read_csv(os.path.join(
-        path, 'perf_NONE_32BIT.csv'), delimiter=';')
-    dfnone64 = pd.read_csv(os.path.join(
-        path, 'perf_NONE_64BIT.csv'), delimiter=';')
+    dfnone32 = readPerf(path, 'perf_NONE_32BIT.csv')
+    dfnone64 = readPerf(path, 'perf_NONE_64BIT.csv')
     data32 = pd.DataFrame()
     data64 = pd.DataFrame()
     for fl in fileList32:
-        dfi = pd.read_csv(os.path.join(path, fl), delimiter=';')
+        dfi = readPerf(path, fl)
         filename = os.path.basename(fl)
         titel = re.search(r'perf_([\w_\d]+).csv', filename).group(1)
         dfi = dfi.drop(labels=['MAX', 'MIN', 'COUNT','AVG'], axis=1)
@@ -46,7 +67,7 @@ def readData(path):
         dfi = dfi.set_index('TAGS')
         data32 = pd.concat([data32, dfi], axis=1)
     for fl in fileList64:
-        dfi = pd.read_csv(os.path.join(path, fl), delimiter=';')
+        dfi = readPerf(path, fl)
         filename = os.path.basename(fl)
         titel = re.search(r'perf_([\w_\d]+).csv', filename).group(1)
         dfi = dfi.drop(labels=['MAX', 'MIN', 'COUNT','AVG'], axis=1)
@@ -73,11 +94,35 @@ def readData(path):
     data64.to_csv(os.path.join(path, "out64.csv"))
     return (data32, data64)
 
-def makePlot(data32,data64):
+def readStats(path):
+    # Slowdown with the bootstrap intervals of the benchmark driver, throughput of the scalar operations
+    df = pd.read_csv(os.path.join(path, 'stats_all.csv'), delimiter=';')
+    df = df[(df['MODE'] == 'tp') & (df['OPERATION'] != 'empty') &
+            ~df['OPERATION'].str.contains('_n$|_soa$')]
+    result = []
+    for width, labels in ((32, ["AN 32", "1's comp. 32", "2's comp 32", "Res. 32"]),
+                          (64, ["AN 64", "1's comp. 64", "2's comp 64", "Res. 64"])):
+        data = pd.DataFrame()
+        low = pd.DataFrame()
+        high = pd.DataFrame()
+        for coding, label in zip(['an', 'onecmp', 'twocmp', 'res'], labels):
+            dfi = df[df['CODING'] == coding + str(width)].set_index('OPERATION')
+            dfi.index = dfi.index.str.upper()
+            data[label] = dfi['SLOWDOWN']
+            low[label] = dfi['SLOWDOWN'] - dfi['SLOWDOWN_LOW']
+            high[label] = dfi['SLOWDOWN_HIGH'] - dfi['SLOWDOWN']
+        data.index.name = 'TAGS'
+        # Asymmetric error bars: columns x (low, high) x rows
+        err = np.stack([low.to_numpy().T, high.to_numpy().T], axis=1)
+        result += [data, err]
+    return tuple(result)
+
+def makePlot(data32,data64,err32=None,err64=None):
     linew = 0.6
     figure, axes = plt.subplots(2, 1)
     figure.subplots_adjust(wspace=0, hspace=0)
-    ax1 = data32.plot.bar(ax=axes[0], width=0.9,edgecolor='k',linewidth=0.3)
+    ax1 = data32.plot.bar(ax=axes[0], width=0.9,edgecolor='k',linewidth=0.3,
+                          yerr=err32, error_kw={'elinewidth': 0.3})
     for axis in ['top','bottom','left','right']:
         ax1.spines[axis].set_linewidth(linew)
     leg = ax1.legend(bbox_to_anchor=(0, 1.02, 1, 0.2), loc="upper left",
@@ -86,7 +131,8 @@ def makePlot(data32,data64):
     leg.get_frame().set_boxstyle('Round', pad=0, rounding_size=0)
     leg.get_frame().set_linewidth(linew)
 
-    ax2 = data64.plot.bar(ax=axes[1], width=0.9,edgecolor='k',linewidth=0.3)
+    ax2 = data64.plot.bar(ax=axes[1], width=0.9,edgecolor='k',linewidth=0.3,
+                          yerr=err64, error_kw={'elinewidth': 0.3})
     for axis in ['top','bottom','left','right']:
         ax2.spines[axis].set_linewidth(linew)
     leg = ax2.legend(bbox_to_anchor=(0, 1.02, 1, 0.2), loc="upper left",
@@ -112,10 +158,15 @@ def makePlot(data32,data64):
 if __name__ == '__main__':
     
     path = os.path.join(os.getcwd(), sys.argv[1])
-    (data32, data64) = readData(path)
+    # The stats of the benchmark driver have the slowdown with intervals, older results only the timings
+    if os.path.exists(os.path.join(path, 'stats_all.csv')):
+        (data32, err32, data64, err64) = readStats(path)
+    else:
+        (data32, data64) = readData(path)
+        err32 = err64 = None
 
     setup_matplotlib()
-    figure = makePlot(data32,data64)
+    figure = makePlot(data32,data64,err32,err64)
     figure.set_size_inches(cm_to_inch(12.5), cm_to_inch(8))
     plt.tight_layout()
     figure.savefig(os.path.join(path, 'perf.png'),
@@ -0,0 +1,210 @@
+/**
+ * @copyright: (c) 2022, Institute for Control Engineering of Machine Tools and Manufacturing Units,
+ *             University of Stuttgart
+ *             All rights reserved. Licensed under the Apache License, Version 2.0 (the "License");
+ *             you may not use this file except in compliance with the License.
+ *             You may obtain a copy of the License at
+ *                  http://www.apache.org/licenses/LICENSE-2.0
+ *             Unless required by applicable law or agreed to in writing, software
+ *             distributed under the License is distributed on an "AS IS" BASIS,
+ *             WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *             See the License for the specific language governing permissions and
+ *             limitations under the License.
+ * @author: Marc Fischer <marc.fischer@isw.uni-stuttgart.de>
+ * @description: Work-stealing thread pool of the fault simulations
+ */
+#include "detcap_pool.h"
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+// Range of tasks [begin, end) packed as begin << 32 | end, so the owner and the thieves change it with one CAS
+#define RANGE(begin, end) (((uint64_t)(begin) << 32) | (uint64_t)(end))
+#define RANGE_BEGIN(range) ((size_t)((range) >> 32))
+#define RANGE_END(range) ((size_t)((range)&0xffffffff))
+
+struct detcap_worker {
+	detcap_pool_t *pool;
+	int id;
+	pthread_t thread;
+	_Atomic uint64_t range;
+	uint64_t *counters;
+};
+
+struct detcap_pool {
+	pthread_mutex_t lock;
+	pthread_cond_t start;
+	pthread_cond_t done;
+	unsigned long generation; //Incremented for each job
+	int active; //Workers still working on the job
+	int stop;
+	detcap_pool_fn fn;
+	void *arg;
+	size_t counterCount;
+	atomic_size_t finished; //Tasks done of the job
+	int threads;
+	struct detcap_worker *workers;
+};
+
+// Takes the next task of the own range
+static int detcap_pool_pop(struct detcap_worker *worker, size_t *task)
+{
+	uint64_t range = atomic_load(&worker->range);
+	while (RANGE_BEGIN(range) < RANGE_END(range)) {
+		uint64_t next = RANGE(RANGE_BEGIN(range) + 1, RANGE_END(range));
+		if (atomic_compare_exchange_weak(&worker->range, &range, next)) {
+			*task = RANGE_BEGIN(range);
+			return 1;
+		}
+	}
+	return 0;
+}
+
+// Moves the upper half of the range of another worker to the own empty range. 0 if all ranges are empty.
+static int detcap_pool_steal(struct detcap_worker *worker)
+{
+	detcap_pool_t *pool = worker->pool;
+	for (int i = 1; i < pool->threads; i++) {
+		struct detcap_worker *victim =
+			&pool->workers[(worker->id + i) % pool->threads];
+		uint64_t range = atomic_load(&victim->range);
+		while (RANGE_BEGIN(range) < RANGE_END(range)) {
+			size_t begin = RANGE_BEGIN(range);
+			size_t end = RANGE_END(range);
+			size_t mid = begin + (end - begin) / 2;
+			if (atomic_compare_exchange_weak(&victim->range, &range,
+							 RANGE(begin, mid))) {
+				//Only the owner changes an empty range
+				atomic_store(&worker->range, RANGE(mid, end));
+				return 1;
+			}
+		}
+	}
+	return 0;
+}
+
+static void *detcap_pool_loop(void *data)
+{
+	struct detcap_worker *worker = data;
+	detcap_pool_t *pool = worker->pool;
+	unsigned long seen = 0;
+
+	while (1) {
+		pthread_mutex_lock(&pool->lock);
+		while (pool->generation == seen && !pool->stop) {
+			pthread_cond_wait(&pool->start, &pool->lock);
+		}
+		if (pool->stop) {
+			pthread_mutex_unlock(&pool->lock);
+			return NULL;
+		}
+		seen = pool->generation;
+		pthread_mutex_unlock(&pool->lock);
+
+		size_t task;
+		do {
+			while (detcap_pool_pop(worker, &task)) {
+				pool->fn(pool->arg, task, worker->counters);
+				atomic_fetch_add_explicit(&pool->finished, 1,
+							  memory_order_relaxed);
+			}
+		} while (detcap_pool_steal(worker));
+
+		pthread_mutex_lock(&pool->lock);
+		if (--pool->active == 0) {
+			pthread_cond_signal(&pool->done);
+		}
+		pthread_mutex_unlock(&pool->lock);
+	}
+}
+
+detcap_pool_t *detcap_pool_create(int threads)
+{
+	if (threads <= 0) {
+		threads = sysconf(_SC_NPROCESSORS_ONLN);
+	}
+	detcap_pool_t *pool = calloc(1, sizeof(detcap_pool_t));
+	if (pool == NULL) {
+		return NULL;
+	}
+	pool->workers = calloc(threads, sizeof(struct detcap_worker));
+	if (pool->workers == NULL) {
+		free(pool);
+		return NULL;
+	}
+	pthread_mutex_init(&pool->lock, NULL);
+	pthread_cond_init(&pool->start, NULL);
+	pthread_cond_init(&pool->done, NULL);
+	for (int i = 0; i < threads; i++) {
+		pool->workers[i].pool = pool;
+		pool->workers[i].id = i;
+		atomic_init(&pool->workers[i].range, 0);
+		if (pthread_create(&pool->workers[i].thread, NULL,
+				   detcap_pool_loop, &pool->workers[i]) != 0) {
+			perror("[error] Could not create worker");
+			break;
+		}
+		pool->threads++;
+	}
+	if (pool->threads != threads) {
+		detcap_pool_destroy(pool);
+		return NULL;
+	}
+	return pool;
+}
+
+void detcap_pool_run(detcap_pool_t *pool, detcap_pool_fn fn, void *arg,
+		     size_t tasks, uint64_t *counters, size_t counterCount)
+{
+	pthread_mutex_lock(&pool->lock);
+	pool->fn = fn;
+	pool->arg = arg;
+	pool->counterCount = counterCount;
+	atomic_store(&pool->finished, 0);
+	for (int i = 0; i < pool->threads; i++) {
+		struct detcap_worker *worker = &pool->workers[i];
+		free(worker->counters);
+		worker->counters = calloc(counterCount, sizeof(uint64_t));
+		atomic_store(&worker->range,
+			     RANGE(tasks * i / pool->threads,
+				   tasks * (i + 1) / pool->threads));
+	}
+	pool->active = pool->threads;
+	pool->generation++;
+	pthread_cond_broadcast(&pool->start);
+	while (pool->active > 0) {
+		pthread_cond_wait(&pool->done, &pool->lock);
+	}
+	memset(counters, 0, counterCount * sizeof(uint64_t));
+	for (int i = 0; i < pool->threads; i++) {
+		for (size_t c = 0; c < counterCount; c++) {
+			counters[c] += pool->workers[i].counters[c];
+		}
+	}
+	pthread_mutex_unlock(&pool->lock);
+}
+
+size_t detcap_pool_progress(detcap_pool_t *pool)
+{
+	return atomic_load_explicit(&pool->finished, memory_order_relaxed);
+}
+
+void detcap_pool_destroy(detcap_pool_t *pool)
+{
+	pthread_mutex_lock(&pool->lock);
+	pool->stop = 1;
+	pthread_cond_broadcast(&pool->start);
+	pthread_mutex_unlock(&pool->lock);
+	for (int i = 0; i < pool->threads; i++) {
+		pthread_join(pool->workers[i].thread, NULL);
+		free(pool->workers[i].counters);
+	}
+	pthread_mutex_destroy(&pool->lock);
+	pthread_cond_destroy(&pool->start);
+	pthread_cond_destroy(&pool->done);
+	free(pool->workers);
+	free(pool);
+}
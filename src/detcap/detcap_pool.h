@@ -0,0 +1,39 @@
+/**
+ * @copyright: (c) 2022, Institute for Control Engineering of Machine Tools and Manufacturing Units,
+ *             University of Stuttgart
+ *             All rights reserved. Licensed under the Apache License, Version 2.0 (the "License");
+ *             you may not use this file except in compliance with the License.
+ *             You may obtain a copy of the License at
+ *                  http://www.apache.org/licenses/LICENSE-2.0
+ *             Unless required by applicable law or agreed to in writing, software
+ *             distributed under the License is distributed on an "AS IS" BASIS,
+ *             WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *             See the License for the specific language governing permissions and
+ *             limitations under the License.
+ * @author: Marc Fischer <marc.fischer@isw.uni-stuttgart.de>
+ * @description: Work-stealing thread pool of the fault simulations. A job is split into tasks 0..tasks-1, each
+ *               worker starts with an equal range of the tasks and steals half of the remaining range of
+ *               another worker when its own range is empty. Each worker adds its results to its own counters,
+ *               they are summed when the job is done, so the results do not depend on the schedule.
+ */
+#ifndef DETCAP_POOL_H_
+#define DETCAP_POOL_H_ 1
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Runs one task and adds its results to the counters of the worker
+typedef void (*detcap_pool_fn)(void *arg, size_t task, uint64_t *counters);
+typedef struct detcap_pool detcap_pool_t;
+
+// Starts threads workers, 0 for one per online core
+detcap_pool_t *detcap_pool_create(int threads);
+// Calls fn(arg, task, counters) for all tasks 0..tasks-1 (less than 2^32) and returns when all tasks are done.
+// counters[0..counterCount-1] are set to the sums of the counters of all workers.
+void detcap_pool_run(detcap_pool_t *pool, detcap_pool_fn fn, void *arg,
+		     size_t tasks, uint64_t *counters, size_t counterCount);
+// Tasks done of the running job, can be called by any thread
+size_t detcap_pool_progress(detcap_pool_t *pool);
+void detcap_pool_destroy(detcap_pool_t *pool);
+
+#endif //DETCAP_POOL_H_
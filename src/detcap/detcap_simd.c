@@ -0,0 +1,142 @@
+/**
+ * @copyright: (c) 2022, Institute for Control Engineering of Machine Tools and Manufacturing Units,
+ *             University of Stuttgart
+ *             All rights reserved. Licensed under the Apache License, Version 2.0 (the "License");
+ *             you may not use this file except in compliance with the License.
+ *             You may obtain a copy of the License at
+ *                  http://www.apache.org/licenses/LICENSE-2.0
+ *             Unless required by applicable law or agreed to in writing, software
+ *             distributed under the License is distributed on an "AS IS" BASIS,
+ *             WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *             See the License for the specific language governing permissions and
+ *             limitations under the License.
+ * @author: Marc Fischer <marc.fischer@isw.uni-stuttgart.de>
+ * @description: AVX2 kernels of the check rules of the detcap codings
+ */
+#include "detcap_simd.h"
+#include <string.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+
+int detcap_simd_available(void)
+{
+	return __builtin_cpu_supports("avx2");
+}
+
+// Bit i of the result is set if lane i of a (i < 16) or lane i - 16 of b is not zero
+__attribute__((target("avx2"))) static uint32_t movemask16(__m256i a,
+							       __m256i b)
+{
+	//packs works in each 128 bit half, the permute restores the order of the lanes
+	__m256i packed = _mm256_permute4x64_epi64(_mm256_packs_epi16(a, b),
+						  _MM_SHUFFLE(3, 1, 2, 0));
+	return _mm256_movemask_epi8(packed);
+}
+
+__attribute__((target("avx2"))) void
+detcap_simd_codeset8(int rule, uint8_t A, uint64_t rows[256][4])
+{
+	//Accepted code word of each x as int16, x / A by the multiply high with 2^16 / A + 1 is exact for x < 256
+	__m256i accepted[16];
+	__m256i a = _mm256_set1_epi16(A);
+	__m256i magic = _mm256_set1_epi16(A > 1 ? 65536 / A + 1 : 0);
+	for (int v = 0; v < 16; v++) {
+		__m256i x = _mm256_add_epi16(
+			_mm256_set1_epi16(16 * v),
+			_mm256_setr_epi16(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11,
+					  12, 13, 14, 15));
+		__m256i res = _mm256_sub_epi16(
+			x, _mm256_mullo_epi16(_mm256_mulhi_epu16(x, magic), a));
+		if (A == 1) {
+			res = _mm256_setzero_si256();
+		}
+		switch (rule) {
+		case DETCAP_RULE_RES:
+			accepted[v] = res;
+			break;
+		case DETCAP_RULE_INV_RES:
+			accepted[v] = _mm256_sub_epi16(a, res);
+			break;
+		case DETCAP_RULE_ONES_COMP:
+			//~x = -x - 1
+			accepted[v] = _mm256_sub_epi16(
+				_mm256_set1_epi16(-1), x);
+			break;
+		default:
+			accepted[v] = _mm256_sub_epi16(
+				_mm256_setzero_si256(), x);
+			break;
+		}
+	}
+	for (int x_enc = 0; x_enc < 256; x_enc++) {
+		__m256i enc = _mm256_set1_epi16(x_enc);
+		for (int w = 0; w < 4; w++) {
+			uint64_t lo = movemask16(
+				_mm256_cmpeq_epi16(accepted[4 * w], enc),
+				_mm256_cmpeq_epi16(accepted[4 * w + 1], enc));
+			uint64_t hi = movemask16(
+				_mm256_cmpeq_epi16(accepted[4 * w + 2], enc),
+				_mm256_cmpeq_epi16(accepted[4 * w + 3], enc));
+			rows[x_enc][w] = lo | hi << 32;
+		}
+	}
+}
+
+__attribute__((target("avx2"))) void
+detcap_simd_codeset_an(uint16_t A, uint64_t valid[1024], uint16_t x[65536])
+{
+	int s = __builtin_ctz(A);
+	uint16_t d = A >> s;
+	//Inverse of the odd d modulo 2^16, each Newton step doubles the correct bits
+	uint16_t inv = d;
+	for (int i = 0; i < 4; i++) {
+		inv *= 2 - d * inv;
+	}
+	__m256i vinv = _mm256_set1_epi16(inv);
+	__m256i bound = _mm256_set1_epi16(UINT16_MAX / A);
+	__m128i right = _mm_cvtsi32_si128(s);
+	__m128i left = _mm_cvtsi32_si128(16 - s);
+	__m256i step = _mm256_set1_epi16(16);
+	__m256i x_enc = _mm256_setr_epi16(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11,
+					  12, 13, 14, 15);
+	for (int w = 0; w < 1024; w++) {
+		uint64_t bits = 0;
+		for (int h = 0; h < 2; h++) {
+			__m256i divisible[2];
+			for (int i = 0; i < 2; i++) {
+				//x_enc is divisible by A iff the rotation of x_enc * inv is at most UINT16_MAX / A,
+				//which is x_enc / A then
+				__m256i q = _mm256_mullo_epi16(x_enc, vinv);
+				q = _mm256_or_si256(_mm256_srl_epi16(q, right),
+						    _mm256_sll_epi16(q, left));
+				divisible[i] = _mm256_cmpeq_epi16(
+					_mm256_min_epu16(q, bound), q);
+				_mm256_storeu_si256(
+					(__m256i *)&x[64 * w + 32 * h + 16 * i],
+					_mm256_and_si256(q, divisible[i]));
+				x_enc = _mm256_add_epi16(x_enc, step);
+			}
+			bits |= (uint64_t)movemask16(divisible[0], divisible[1])
+				<< (32 * h);
+		}
+		valid[w] = bits;
+	}
+}
+
+#else
+
+int detcap_simd_available(void)
+{
+	return 0;
+}
+
+void detcap_simd_codeset8(int rule, uint8_t A, uint64_t rows[256][4])
+{
+}
+
+void detcap_simd_codeset_an(uint16_t A, uint64_t valid[1024], uint16_t x[65536])
+{
+}
+
+#endif
@@ -0,0 +1,42 @@
+/**
+ * @copyright: (c) 2022, Institute for Control Engineering of Machine Tools and Manufacturing Units,
+ *             University of Stuttgart
+ *             All rights reserved. Licensed under the Apache License, Version 2.0 (the "License");
+ *             you may not use this file except in compliance with the License.
+ *             You may obtain a copy of the License at
+ *                  http://www.apache.org/licenses/LICENSE-2.0
+ *             Unless required by applicable law or agreed to in writing, software
+ *             distributed under the License is distributed on an "AS IS" BASIS,
+ *             WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *             See the License for the specific language governing permissions and
+ *             limitations under the License.
+ * @author: Marc Fischer <marc.fischer@isw.uni-stuttgart.de>
+ * @description: AVX2 kernels of the check rules of the detcap codings. They evaluate the check of 16 or 32
+ *               pairs per instruction to build the code sets of one A. The kernels are compiled for AVX2 by a
+ *               function attribute and only called if detcap_simd_available() returns 1, otherwise detcap
+ *               calls the check functions.
+ */
+#ifndef DETCAP_SIMD_H_
+#define DETCAP_SIMD_H_ 1
+
+#include <stdint.h>
+
+// Check rules of the 8bit codings, each accepts one code word per x with the int semantics of the check
+// functions: x % A, A - x % A, ~x and ~x + 1 (never or only for 0 in 0..255 for the complements)
+enum DETCAP_RULE {
+	DETCAP_RULE_RES,
+	DETCAP_RULE_INV_RES,
+	DETCAP_RULE_ONES_COMP,
+	DETCAP_RULE_TWOS_COMP,
+	DETCAP_RULES
+};
+
+// 1 if the CPU supports AVX2
+int detcap_simd_available(void);
+// Sets bit x of rows[x_enc] for each pair accepted by the rule for A, 32 x per instruction
+void detcap_simd_codeset8(int rule, uint8_t A, uint64_t rows[256][4]);
+// Sets the bit of each code word of A accepted by check_an and its decoded x. The divisibility by
+// A = 2^s * d is tested with the modular inverse of d for 16 code words per instruction.
+void detcap_simd_codeset_an(uint16_t A, uint64_t valid[1024], uint16_t x[65536]);
+
+#endif //DETCAP_SIMD_H_
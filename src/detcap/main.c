@@ -15,13 +15,22 @@
  */
 
 #include "helpers.h"
+#include "detcap_pool.h"
+#include "detcap_simd.h"
 #include <stdio.h>
+#include <stdlib.h>
 #include <stdbool.h>
 #include <string.h>
 #include <pthread.h>
 #include <errno.h>
 #include <unistd.h>
 
+static detcap_pool_t *pool;
+//Compares each lookup of the code sets with the check function, the differences are printed as error
+static bool crossCheck = false;
+//Builds the code sets with the AVX2 kernels of the check rules, cleared without AVX2 or by the option scalar
+static bool useSimd = false;
+
 uint8_t enc_res(uint8_t x, uint8_t A)
 {
 	return x % A;
@@ -64,6 +73,150 @@ uint8_t check_an(uint16_t x, uint16_t x_enc, uint16_t A)
 	return x_enc % A == 0 && x * A == x_enc;
 }
 
+// Pairs (x, x_enc) of one A accepted by the check function of an 8bit coding, as bitmap by x_enc and by x
+struct codeset {
+	uint64_t byEnc[256][4];
+	uint64_t byX[256][4];
+};
+
+static inline int codeset_valid(const struct codeset *set, uint8_t x,
+				uint8_t x_enc)
+{
+	return (set->byEnc[x_enc][x >> 6] >> (x & 63)) & 1;
+}
+
+struct codeset_job {
+	uint8_t (*check_fun)(uint8_t, uint8_t, uint8_t);
+	int rule; //Rule of the AVX2 kernel, -1 for the check function
+	struct codeset *sets; //Indexed by A
+};
+
+// Rule of the AVX2 kernel of a check function, -1 if there is none
+static int codeset_rule(uint8_t (*check_fun)(uint8_t, uint8_t, uint8_t))
+{
+	if (check_fun == check_res) {
+		return DETCAP_RULE_RES;
+	} else if (check_fun == check_inv_res) {
+		return DETCAP_RULE_INV_RES;
+	} else if (check_fun == check_ones_comp) {
+		return DETCAP_RULE_ONES_COMP;
+	} else if (check_fun == check_twos_comp) {
+		return DETCAP_RULE_TWOS_COMP;
+	}
+	return -1;
+}
+
+// Task A-1, one check per pair instead of one per fault
+void codeset_task(void *arg, size_t task, uint64_t *counters)
+{
+	struct codeset_job *job = arg;
+	int A = task + 1;
+	struct codeset *set = &job->sets[A];
+	if (job->rule >= 0) {
+		detcap_simd_codeset8(job->rule, A, set->byEnc);
+		//Transposes the few accepted pairs
+		for (int x_enc = 0; x_enc < 256; x_enc++) {
+			for (int w = 0; w < 4; w++) {
+				for (uint64_t bits = set->byEnc[x_enc][w];
+				     bits != 0; bits &= bits - 1) {
+					int x = 64 * w + __builtin_ctzll(bits);
+					set->byX[x][x_enc >> 6] |=
+						1ul << (x_enc & 63);
+				}
+			}
+		}
+		return;
+	}
+	for (int x_enc = 0; x_enc < 256; x_enc++) {
+		for (int x = 0; x < 256; x++) {
+			if (job->check_fun(x, x_enc, A)) {
+				set->byEnc[x_enc][x >> 6] |= 1ul << (x & 63);
+				set->byX[x][x_enc >> 6] |= 1ul << (x_enc & 63);
+			}
+		}
+	}
+}
+
+// Code sets of the As 1..count, NULL if out of memory
+struct codeset *codeset_create(uint8_t (*check_fun)(uint8_t, uint8_t, uint8_t),
+			       int count)
+{
+	struct codeset_job job = { check_fun,
+				   useSimd ? codeset_rule(check_fun) : -1,
+				   calloc(count + 1, sizeof(struct codeset)) };
+	if (job.sets != NULL) {
+		detcap_pool_run(pool, codeset_task, &job, count, NULL, 0);
+	}
+	return job.sets;
+}
+
+// Code words of AN for one A. Each x_enc is the code word of at most one x, so a bitmap of the code words and
+// the decoded x hold all pairs accepted by check_an, also for x larger than 8bit.
+struct codeset_an {
+	uint64_t valid[(UINT16_MAX + 1) / 64];
+	uint16_t x[UINT16_MAX + 1];
+};
+
+static inline int codeset_an_valid(const struct codeset_an *set, uint16_t x,
+				   uint16_t x_enc)
+{
+	return ((set->valid[x_enc >> 6] >> (x_enc & 63)) & 1) &&
+	       set->x[x_enc] == x;
+}
+
+// Task A-1, check_an accepts only x = x_enc / A for x_enc
+void codeset_an_task(void *arg, size_t task, uint64_t *counters)
+{
+	struct codeset_an *set = (struct codeset_an *)arg + task + 1;
+	uint16_t A = task + 1;
+	if (useSimd) {
+		detcap_simd_codeset_an(A, set->valid, set->x);
+		return;
+	}
+	for (unsigned int x_enc = 0; x_enc <= UINT16_MAX; x_enc++) {
+		uint16_t x = x_enc / A;
+		if (check_an(x, x_enc, A)) {
+			set->valid[x_enc >> 6] |= 1ul << (x_enc & 63);
+			set->x[x_enc] = x;
+		}
+	}
+}
+
+struct codeset_an *codeset_an_create()
+{
+	struct codeset_an *sets = calloc(256, sizeof(struct codeset_an));
+	if (sets != NULL) {
+		detcap_pool_run(pool, codeset_an_task, sets, 255, NULL, 0);
+	}
+	return sets;
+}
+
+// Prints the number of lookups that differ from the check function, counted in counters[0]
+void codeset_report(const char *name, uint64_t differences)
+{
+	if (crossCheck) {
+		printf("[%s] Cross-check of the code set of %s: %lu differences\n",
+		       differences == 0 ? "Info" : "Error", name,
+		       differences);
+	}
+}
+
+struct cd_job {
+	uint8_t (*enc_fun)(uint8_t, uint8_t);
+};
+
+// Task A-1, counters[9 * A + hd] is the histogram of A
+void cd_8bit_task(void *arg, size_t task, uint64_t *counters)
+{
+	struct cd_job *job = arg;
+	int A = task + 1;
+	for (int i = 0; i < 256; i++) {
+		uint8_t x = i;
+		uint8_t x_enc = job->enc_fun(x, (uint8_t)A);
+		counters[9 * A + calcHammingDistance8(x_enc, x)]++;
+	}
+}
+
 void cd_8bit(uint8_t (*enc_fun)(uint8_t, uint8_t), char *name, bool noA)
 {
 	printf("~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\n");
@@ -75,26 +228,20 @@ void cd_8bit(uint8_t (*enc_fun)(uint8_t, uint8_t), char *name, bool noA)
 	for (int i = 0; i < 256; ++i)
 		minHammingDistance[i] = INT32_MAX;
 	float avgHammingDistance[256] = { 0.0 };
+	struct cd_job job = { enc_fun };
+	detcap_pool_run(pool, cd_8bit_task, &job, noA ? 1 : 255, &hist[0][0],
+			256 * 9);
 	for (int A = 1; A <= 255; A++) {
 		if (noA && A > 1) {
 			break;
 		}
-		int num = 0;
-		for (int i = 0; i < count; i++) {
-			uint8_t x = i;
-			uint8_t x_enc = enc_fun(x, (uint8_t)A);
-
-			int hd = calcHammingDistance8(x_enc, x);
-			avgHammingDistance[A] += hd;
-			num++;
-			hist[A][hd]++;
-			if (hd == 0) {
-				int dgb_b = 3;
-			}
-			if (hd < minHammingDistance[A])
+		//Integer sum of the distances, exact in float like the former running sum
+		for (int hd = 8; hd >= 0; hd--) {
+			avgHammingDistance[A] += hd * hist[A][hd];
+			if (hist[A][hd] > 0)
 				minHammingDistance[A] = hd;
 		}
-		avgHammingDistance[A] /= num;
+		avgHammingDistance[A] /= count;
 	}
 	printf("    Code Distance \n");
 	if (noA) {
@@ -138,6 +285,17 @@ void cd_8bit(uint8_t (*enc_fun)(uint8_t, uint8_t), char *name, bool noA)
 	printf("\n\n\n");
 }
 
+// Task A-1, counters[18 * A + hd] is the histogram of A
+void cd_an_sep_8bit_task(void *arg, size_t task, uint64_t *counters)
+{
+	int A = task + 1;
+	for (int i = 1; i < 256; i++) {
+		uint16_t x = i;
+		uint16_t x_enc = (uint16_t)x * (uint16_t)A;
+		counters[18 * A + calcHammingDistance16(x_enc, x)]++;
+	}
+}
+
 void cd_an_sep_8bit()
 {
 	printf("~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\n");
@@ -146,22 +304,17 @@ void cd_an_sep_8bit()
 	int count = 256;
 	uint64_t hist[256][18] = { 0 };
 	float histAvg[256] = { 0.0 };
+	detcap_pool_run(pool, cd_an_sep_8bit_task, NULL, 255, &hist[0][0],
+			256 * 18);
 	for (int A = 1; A <= 255; A++) {
 		int minHammingDistance = INT32_MAX;
 		double avgHammingDistance = 0;
-		int num = 0;
-		for (int i = 1; i < count; i++) {
-			uint16_t x = i;
-			uint16_t x_enc = (uint16_t)x * (uint16_t)A;
-
-			int hd = calcHammingDistance16(x_enc, x);
-			avgHammingDistance += hd;
-			num++;
-			hist[A][hd]++;
-			if (hd < minHammingDistance)
+		for (int hd = 16; hd >= 0; hd--) {
+			avgHammingDistance += hd * hist[A][hd];
+			if (hist[A][hd] > 0)
 				minHammingDistance = hd;
 		}
-		avgHammingDistance /= num;
+		avgHammingDistance /= count - 1;
 		histAvg[A] = avgHammingDistance;
 		hist[A][17] = minHammingDistance;
 	}
@@ -192,6 +345,55 @@ void cd_an_sep_8bit()
 	printf("\n\n\n");
 }
 
+struct fault_job {
+	uint8_t (*enc_fun)(uint8_t, uint8_t);
+	uint8_t (*check_fun)(uint8_t, uint8_t, uint8_t);
+	struct codeset *sets;
+};
+
+// Task (A-1) * 256 + x, counters[2 * A] are the SDCs and counters[2 * A + 1] the masked faults of A,
+// counters[0] the differences of the cross-check.
+// The faults are counted as if all pairs j, k of mask0 = j ^ (j & k) and mask1 = j & k were simulated: Each bit
+// of j is stuck, at the value of k. A bit that is not stuck occurs for both values of k, so each pattern of stuck
+// bits j and stuck values (the submasks of j) is simulated once and weighted with 2^(bits not stuck).
+void sdc_perm_8bit_task(void *arg, size_t task, uint64_t *counters)
+{
+	struct fault_job *job = arg;
+	int count = 256;
+	int A = task / 256 + 1;
+	uint8_t x = task % 256;
+	uint8_t x_enc = job->enc_fun(x, (uint8_t)A);
+	const struct codeset *set = &job->sets[A];
+	for (int j = 0; j < count; j++) {
+		uint64_t weight = 1ul << (8 - calcHammingDistance8(j, 0));
+		for (int k = j;; k = (k - 1) & j) {
+			uint8_t mask0 = j ^ k;
+			uint8_t mask1 = k;
+			uint8_t stuck_x = x & (~mask0);
+			stuck_x = stuck_x | mask1;
+			uint8_t stuck_x_enc = x_enc & (~mask0);
+			stuck_x_enc = stuck_x_enc | mask1;
+			int isMasked_stuck =
+				stuck_x == x && stuck_x_enc == x_enc;
+			int check_stuck =
+				codeset_valid(set, stuck_x, stuck_x_enc);
+			if (crossCheck &&
+			    check_stuck !=
+				    !!job->check_fun(stuck_x, stuck_x_enc, A)) {
+				counters[0]++;
+			}
+			if (isMasked_stuck) {
+				counters[2 * A + 1] += weight;
+			} else if (check_stuck) {
+				counters[2 * A] += weight;
+			}
+			if (k == 0) {
+				break;
+			}
+		}
+	}
+}
+
 void sdc_perm_8bit(uint8_t (*enc_fun)(uint8_t, uint8_t),
 		  uint8_t (*check_fun)(uint8_t, uint8_t, uint8_t), char *name,
 		  bool noA)
@@ -199,41 +401,22 @@ void sdc_perm_8bit(uint8_t (*enc_fun)(uint8_t, uint8_t),
 	printf("~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\n");
 	printf("Perm Stuck-at SDCs for %s on 8bit  \n", name);
 	printf("~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\n");
-	int count = 256;
+	uint64_t counters[256][2];
+	struct fault_job job = { enc_fun, check_fun,
+				 codeset_create(check_fun, noA ? 1 : 255) };
+	if (job.sets == NULL) {
+		printf("[Error] Could not allocate the code sets\n");
+		return;
+	}
+	detcap_pool_run(pool, sdc_perm_8bit_task, &job, (noA ? 1 : 255) * 256,
+			&counters[0][0], 256 * 2);
+	codeset_report(name, counters[0][0]);
+	free(job.sets);
 	uint64_t sdcs[256];
 	uint64_t masked[256];
 	for (int A = 1; A <= 255; A++) {
-		sdcs[A] = 0;
-		masked[A] = 0;
-		if (noA && A > 1) {
-			break;
-		}
-		printf("#");
-		fflush(stdout);
-		for (int i = 0; i < count; i++) {
-			uint8_t x = i;
-			uint8_t x_enc = enc_fun(x, (uint8_t)A);
-			for (int j = 0; j < count; j++) {
-				for (int k = 0; k < count; k++) {
-					uint8_t mask0 = j ^ (j & k);
-					uint8_t mask1 = j & k;
-					uint8_t stuck_x = x & (~mask0);
-					stuck_x = stuck_x | mask1;
-					uint8_t stuck_x_enc = x_enc & (~mask0);
-					stuck_x_enc = stuck_x_enc | mask1;
-					int isMasked_stuck =
-						stuck_x == x &&
-						stuck_x_enc == x_enc;
-					int check_stuck = check_fun(
-						stuck_x, stuck_x_enc, A);
-					if (isMasked_stuck)
-						masked[A]++;
-					if (!isMasked_stuck && check_stuck) {
-						sdcs[A]++;
-					}
-				}
-			}
-		}
+		sdcs[A] = counters[A][0];
+		masked[A] = counters[A][1];
 	}
 	if (!noA) {
 		printf(" A |   SDCs   |  Masked   |\n");
@@ -267,10 +450,14 @@ void sdc_perm_8bit(uint8_t (*enc_fun)(uint8_t, uint8_t),
 	printf("\n\n\n");
 }
 
-uint64_t progress1[256];
-uint64_t progress2[256];
-uint64_t sdcs[256];
-uint64_t masked[256];
+// Block of j handled by one task of the permanent fault simulation of AN
+#define PERM_AN_BLOCK 256
+#define PERM_AN_TASKS_PER_X ((UINT16_MAX + 1) / PERM_AN_BLOCK)
+
+// Progress of each A for progress.txt, the results are the counters of the pool
+_Atomic uint64_t progress[256];
+_Atomic uint64_t sdcs[256];
+_Atomic uint64_t masked[256];
 void *perm_an_stat_loop(void *data)
 {
 	while (true) {
@@ -280,48 +467,68 @@ void *perm_an_stat_loop(void *data)
 			       strerror(errno));
 			return NULL;
 		}
+		// Index of the last x and j as without the pool, 255|65535 when A is finished. The tasks of one A finish
+		// out of order, so the indices follow the number of finished tasks.
 		for (int A = 1; A <= 255; A++) {
-			fprintf(pFile, "%-8lu|%-8lu||%-8lu|%-8lu\n",
-				progress1[A], progress2[A], sdcs[A], masked[A]);
+			uint64_t done = progress[A];
+			uint64_t x = 0, j = 0;
+			if (done > 0) {
+				uint64_t last = done - 1;
+				x = last / PERM_AN_TASKS_PER_X;
+				j = last % PERM_AN_TASKS_PER_X * PERM_AN_BLOCK +
+				    PERM_AN_BLOCK - 1;
+			}
+			fprintf(pFile, "%-8lu|%-8lu||%-8lu|%-8lu\n", x, j,
+				(uint64_t)sdcs[A], (uint64_t)masked[A]);
 		}
 		fclose(pFile);
 		sleep(2);
 	}
 }
 
-void* perm_an_loop(void *A_data)
+// Task ((A-1) * 256 + x) * PERM_AN_TASKS_PER_X + block, counters and weights as for sdc_perm_8bit_task
+void perm_an_task(void *arg, size_t task, uint64_t *counters)
 {
-	int A = *(int *)A_data;
-	fflush(stdout);
-	sdcs[A] = 0;
-	masked[A] = 0;
-	progress1[A] = 0;
-	for (unsigned int i = 0; i < 256; i++) {
-		progress1[A] = i;
-		uint16_t x = i;
-		uint16_t x_enc = enc_an(x, (uint16_t)A);
-		for (unsigned int j = 0; j <= UINT16_MAX; j++) {
-			progress2[A] = j;
-			for (unsigned int k = 0; k <= UINT16_MAX; k++) {
-				uint16_t mask0 = j ^ (j & k);
-				uint16_t mask1 = j & k;
-				uint16_t stuck_x = x & (~mask0);
-				stuck_x = stuck_x | mask1;
-				uint16_t stuck_x_enc = x_enc & (~mask0);
-				stuck_x_enc = stuck_x_enc | mask1;
-				int isMasked_stuck =
-					stuck_x == x && stuck_x_enc == x_enc;
-				int check_stuck =
-					check_an(stuck_x, stuck_x_enc, A);
-				if (isMasked_stuck)
-					masked[A]++;
-				if (!isMasked_stuck && check_stuck) {
-					sdcs[A]++;
-				}
+	const struct codeset_an *set = (struct codeset_an *)arg;
+	int A = task / (256 * PERM_AN_TASKS_PER_X) + 1;
+	uint16_t x = task / PERM_AN_TASKS_PER_X % 256;
+	unsigned int block = task % PERM_AN_TASKS_PER_X * PERM_AN_BLOCK;
+	uint16_t x_enc = enc_an(x, (uint16_t)A);
+	set += A;
+	uint64_t sdcs_task = 0;
+	uint64_t masked_task = 0;
+	for (unsigned int j = block; j < block + PERM_AN_BLOCK; j++) {
+		uint64_t weight = 1ul << (16 - calcHammingDistance16(j, 0));
+		for (unsigned int k = j;; k = (k - 1) & j) {
+			uint16_t mask0 = j ^ k;
+			uint16_t mask1 = k;
+			uint16_t stuck_x = x & (~mask0);
+			stuck_x = stuck_x | mask1;
+			uint16_t stuck_x_enc = x_enc & (~mask0);
+			stuck_x_enc = stuck_x_enc | mask1;
+			int isMasked_stuck =
+				stuck_x == x && stuck_x_enc == x_enc;
+			int check_stuck =
+				codeset_an_valid(set, stuck_x, stuck_x_enc);
+			if (crossCheck &&
+			    check_stuck != check_an(stuck_x, stuck_x_enc, A)) {
+				counters[0]++;
+			}
+			if (isMasked_stuck) {
+				masked_task += weight;
+			} else if (check_stuck) {
+				sdcs_task += weight;
+			}
+			if (k == 0) {
+				break;
 			}
 		}
 	}
-	return NULL;
+	counters[2 * A] += sdcs_task;
+	counters[2 * A + 1] += masked_task;
+	sdcs[A] += sdcs_task;
+	masked[A] += masked_task;
+	progress[A]++;
 }
 
 void sdc_perm_an_8bit()
@@ -330,18 +537,24 @@ void sdc_perm_an_8bit()
 	printf("Perm Stuck-at SDCs for separate AN on 8bit  \n");
 	printf("~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\n");
 
-	pthread_t threads[255];
-	int As[256];
-	for (int A = 1; A <= 255; A++) {
-		As[A] = A;
-		int res =
-			pthread_create(&threads[A], NULL, perm_an_loop, &As[A]);
+	struct codeset_an *sets = codeset_an_create();
+	if (sets == NULL) {
+		printf("[Error] Could not allocate the code sets\n");
+		return;
 	}
 	pthread_t stat;
 	pthread_create(&stat, NULL, perm_an_stat_loop, NULL);
-
+	uint64_t counters[256][2];
+	detcap_pool_run(pool, perm_an_task, sets,
+			255 * 256 * PERM_AN_TASKS_PER_X, &counters[0][0],
+			256 * 2);
+	pthread_cancel(stat);
+	pthread_join(stat, NULL);
+	codeset_report("separate AN", counters[0][0]);
+	free(sets);
 	for (int A = 1; A <= 255; A++) {
-		pthread_join(threads[A], NULL);
+		sdcs[A] = counters[A][0];
+		masked[A] = counters[A][1];
 	}
 	printf(" A |   SDCs   |  Masked   |\n");
 	printf("---+----------+-----------+\n");
@@ -350,8 +563,8 @@ void sdc_perm_an_8bit()
 	for (int A = 1; A <= 255; A++) {
 		int sum0 = 0;
 		printf("%-3d|", A);
-		printf(" %-8lu |", sdcs[A]);
-		printf(" %-8lu  |\n", masked[A]);
+		printf(" %-8lu |", (uint64_t)sdcs[A]);
+		printf(" %-8lu  |\n", (uint64_t)masked[A]);
 		if (sdcs[A] < min) {
 			min = sdcs[A];
 			minA = A;
@@ -362,6 +575,38 @@ void sdc_perm_an_8bit()
 	printf("\n\n\n");
 }
 
+// Task (A-1) * 256 + x, counters as for sdc_perm_8bit_task. The flips of x reach every x' once and the flips of
+// x_enc every x_enc' once, so the SDCs are the accepted pairs in the row of x_enc and of x without (x, x_enc).
+void sdc_trans_8bit_task(void *arg, size_t task, uint64_t *counters)
+{
+	struct fault_job *job = arg;
+	int count = 256;
+	int A = task / 256 + 1;
+	uint8_t x = task % 256;
+	uint8_t x_enc = job->enc_fun(x, (uint8_t)A);
+	const struct codeset *set = &job->sets[A];
+	uint64_t sdcs_task = 0;
+	for (int w = 0; w < 4; w++) {
+		sdcs_task += __builtin_popcountll(set->byEnc[x_enc][w]);
+		sdcs_task += __builtin_popcountll(set->byX[x][w]);
+	}
+	sdcs_task -= 2 * codeset_valid(set, x, x_enc);
+	counters[2 * A] += sdcs_task;
+	//Only the flip with j = 0 is masked
+	counters[2 * A + 1] += 2;
+	if (!crossCheck) {
+		return;
+	}
+	uint64_t sdcs_check = 0;
+	for (int j = 1; j < count; j++) {
+		sdcs_check += !!job->check_fun(x ^ j, x_enc, A);
+		sdcs_check += !!job->check_fun(x, x_enc ^ j, A);
+	}
+	if (sdcs_check != sdcs_task) {
+		counters[0]++;
+	}
+}
+
 void sdc_trans_8bit(uint8_t (*enc_fun)(uint8_t, uint8_t),
 		   uint8_t (*check_fun)(uint8_t, uint8_t, uint8_t), char *name,
 		   bool noA)
@@ -369,41 +614,22 @@ void sdc_trans_8bit(uint8_t (*enc_fun)(uint8_t, uint8_t),
 	printf("~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\n");
 	printf("Trans. flip SDCs for %s on 8bit  \n", name);
 	printf("~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\n");
-	int count = 256;
+	uint64_t counters[256][2];
+	struct fault_job job = { enc_fun, check_fun,
+				 codeset_create(check_fun, noA ? 1 : 255) };
+	if (job.sets == NULL) {
+		printf("[Error] Could not allocate the code sets\n");
+		return;
+	}
+	detcap_pool_run(pool, sdc_trans_8bit_task, &job, (noA ? 1 : 255) * 256,
+			&counters[0][0], 256 * 2);
+	codeset_report(name, counters[0][0]);
+	free(job.sets);
 	uint64_t sdcs[256];
 	uint64_t masked[256];
 	for (int A = 1; A <= 255; A++) {
-		if (noA && A > 1) {
-			break;
-		}
-		sdcs[A] = 0;
-		masked[A] = 0;
-		for (int i = 0; i < count; i++) {
-			uint8_t x = i;
-			uint8_t x_enc = enc_fun(x, (uint8_t)A);
-			for (int j = 0; j < count; j++) {
-				uint8_t trans_x = x ^ j;
-				int isMasked_trans_x = trans_x == x;
-				int check_trans_x =
-					check_fun(trans_x, x_enc, A);
-				if (isMasked_trans_x)
-					masked[A]++;
-				if (!isMasked_trans_x && check_trans_x) {
-					sdcs[A]++;
-				}
-
-				uint8_t trans_x_enc = x_enc ^ j;
-				int isMasked_trans_x_enc = trans_x_enc == x_enc;
-				int check_trans_x_enc =
-					check_fun(x, trans_x_enc, A);
-				if (isMasked_trans_x_enc)
-					masked[A]++;
-				if (!isMasked_trans_x_enc &&
-				    check_trans_x_enc) {
-					sdcs[A]++;
-				}
-			}
-		}
+		sdcs[A] = counters[A][0];
+		masked[A] = counters[A][1];
 	}
 
 	printf(" A | SDCs  | Masked |\n");
@@ -434,43 +660,63 @@ void sdc_trans_8bit(uint8_t (*enc_fun)(uint8_t, uint8_t),
 	printf("\n\n\n");
 }
 
+// Task (A-1) * 256 + x, counters as for sdc_perm_8bit_task. The flips j < UINT16_MAX reach every x' and x_enc'
+// except the complements. check_an accepts one x' for x_enc, the decoded one, and one x_enc' for x, x * A.
+void sdc_trans_an_8bit_task(void *arg, size_t task, uint64_t *counters)
+{
+	int count = UINT16_MAX;
+	int A = task / 256 + 1;
+	uint16_t x = task % 256;
+	uint16_t x_enc = enc_an(x, A);
+	const struct codeset_an *set = (struct codeset_an *)arg + A;
+	uint64_t sdcs_task = 0;
+	uint16_t trans_x = set->x[x_enc];
+	if (codeset_an_valid(set, trans_x, x_enc) && trans_x != x &&
+	    trans_x != (uint16_t)~x) {
+		sdcs_task++;
+	}
+	uint32_t trans_x_enc = (uint32_t)x * A;
+	if (trans_x_enc <= UINT16_MAX &&
+	    codeset_an_valid(set, x, trans_x_enc) && trans_x_enc != x_enc &&
+	    trans_x_enc != (uint16_t)~x_enc) {
+		sdcs_task++;
+	}
+	counters[2 * A] += sdcs_task;
+	//Only the flip with j = 0 is masked
+	counters[2 * A + 1] += 2;
+	if (!crossCheck) {
+		return;
+	}
+	uint64_t sdcs_check = 0;
+	for (int j = 1; j < count; j++) {
+		sdcs_check += check_an(x ^ j, x_enc, A);
+		sdcs_check += check_an(x, x_enc ^ j, A);
+	}
+	if (sdcs_check != sdcs_task) {
+		counters[0]++;
+	}
+}
+
 void sdc_trans_an_8bit()
 {
 	printf("~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\n");
 	printf("Trans. flip SDCs for separate AN on 8bit  \n");
 	printf("~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\n");
-	int count = UINT16_MAX;
+	struct codeset_an *sets = codeset_an_create();
+	if (sets == NULL) {
+		printf("[Error] Could not allocate the code sets\n");
+		return;
+	}
+	uint64_t counters[256][2];
+	detcap_pool_run(pool, sdc_trans_an_8bit_task, sets, 255 * 256,
+			&counters[0][0], 256 * 2);
+	codeset_report("separate AN", counters[0][0]);
+	free(sets);
 	uint64_t sdcs[256];
 	uint64_t masked[256];
 	for (int A = 1; A <= 255; A++) {
-		sdcs[A] = 0;
-		masked[A] = 0;
-		printf(" #");
-		for (int i = 0; i < 256; i++) {
-			uint16_t x = i;
-			uint16_t x_enc = enc_an(x, A);
-			for (int j = 0; j < count; j++) {
-				uint16_t trans_x = x ^ j;
-				int isMasked_trans_x = trans_x == x;
-				int check_trans_x = check_an(trans_x, x_enc, A);
-				if (isMasked_trans_x)
-					masked[A]++;
-				if (!isMasked_trans_x && check_trans_x) {
-					sdcs[A]++;
-				}
-
-				uint16_t trans_x_enc = x_enc ^ j;
-				int isMasked_trans_x_enc = trans_x_enc == x_enc;
-				int check_trans_x_enc =
-					check_an(x, trans_x_enc, A);
-				if (isMasked_trans_x_enc)
-					masked[A]++;
-				if (!isMasked_trans_x_enc &&
-				    check_trans_x_enc) {
-					sdcs[A]++;
-				}
-			}
-		}
+		sdcs[A] = counters[A][0];
+		masked[A] = counters[A][1];
 	}
 
 	printf(" A | SDCs  | Masked |\n");
@@ -494,7 +740,19 @@ void sdc_trans_an_8bit()
 
 int main(int argc, char **argv)
 {
-	if (argc == 2 && strcmp(argv[1], "trans") == 0) {
+	//Optional number of threads, default one per online core
+	int threads = argc >= 3 ? atoi(argv[2]) : 0;
+	crossCheck = argc == 4 && strcmp(argv[3], "check") == 0;
+	bool scalar = argc == 4 && strcmp(argv[3], "scalar") == 0;
+	useSimd = detcap_simd_available() && !scalar;
+	if (argc == 2 || argc == 3 || crossCheck || scalar) {
+		pool = detcap_pool_create(threads);
+		if (pool == NULL) {
+			printf("[Error] Could not create the thread pool\n");
+			return -1;
+		}
+	}
+	if (pool && strcmp(argv[1], "trans") == 0) {
 		sdc_trans_8bit(&enc_res, &check_res, "residue", false);
 		sdc_trans_8bit(&enc_inv_res, &check_inv_res, "inverse residue",
 			       false);
@@ -503,7 +761,7 @@ int main(int argc, char **argv)
 		sdc_trans_8bit(&enc_twos_comp, &check_twos_comp,
 			       "two's complement", true);
 		sdc_trans_an_8bit();
-	} else if (argc == 2 && strcmp(argv[1], "perm") == 0) {
+	} else if (pool && strcmp(argv[1], "perm") == 0) {
 		sdc_perm_8bit(&enc_res, &check_res, "residue", false);
 		sdc_perm_8bit(&enc_inv_res, &check_inv_res, "inverse residue",
 			      false);
@@ -511,9 +769,9 @@ int main(int argc, char **argv)
 			      "ones' complement", true);
 		sdc_perm_8bit(&enc_twos_comp, &check_twos_comp,
 			      "two's complement", true);
-	} else if (argc == 2 && strcmp(argv[1], "perman") == 0) {
+	} else if (pool && strcmp(argv[1], "perman") == 0) {
 		sdc_perm_an_8bit();
-	} else if (argc == 2 && strcmp(argv[1], "cd") == 0) {
+	} else if (pool && strcmp(argv[1], "cd") == 0) {
 		cd_an_sep_8bit();
 		cd_8bit(&enc_res, "residue", false);
 		cd_8bit(&enc_inv_res, "inverse residue", false);
@@ -522,10 +780,16 @@ int main(int argc, char **argv)
 	} else {
 		printf("%s -- HELP\n", argv[0]);
 		printf("use the following arguments to calculate the metrics and fault simulations\n");
+		printf("\t detcap <mode> [threads] - runs the mode on threads workers, default one per core\n");
+		printf("\t detcap <mode> <threads> check - compares the code sets with the check functions\n");
+		printf("\t detcap <mode> <threads> scalar - builds the code sets with the check functions instead of AVX2\n");
 		printf("\t detcap cd - calcs the code distance C_d and hamming distances\n");
 		printf("\t detcap trans - calcs the transient fault simulation\n");
 		printf("\t detcap perm - calcs the permanent fault simulation\n");
 		printf("\t detcap perman - calcs the permanent fault simulation for AN-Coding\n");
 	}
+	if (pool) {
+		detcap_pool_destroy(pool);
+	}
 	return 0;
 }
\ No newline at end of file
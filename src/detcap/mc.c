@@ -0,0 +1,218 @@
+/**
+ * @copyright: (c) 2022, Institute for Control Engineering of Machine Tools and Manufacturing Units,
+ *             University of Stuttgart
+ *             All rights reserved. Licensed under the Apache License, Version 2.0 (the "License");
+ *             you may not use this file except in compliance with the License.
+ *             You may obtain a copy of the License at
+ *                  http://www.apache.org/licenses/LICENSE-2.0
+ *             Unless required by applicable law or agreed to in writing, software
+ *             distributed under the License is distributed on an "AS IS" BASIS,
+ *             WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *             See the License for the specific language governing permissions and
+ *             limitations under the License.
+ * @author: Marc Fischer <marc.fischer@isw.uni-stuttgart.de>
+ * @description: Monte Carlo fault simulation of the 32 and 64 bit codings in codings. Each coding encodes
+ *               random operands, applies a random fault of the model to the state and classifies the outcome.
+ *               Each batch of MC_BATCH samples draws from its own PCG stream of the seed, so the results do not
+ *               depend on the number of threads. Usage:
+ *                   detcap-mc [-e codings] [-f trans|flip|perm] [-b bits] [-n samples] [-w width]
+ *                             [-t threads] [-s seed] [-h]
+ *               A coding stops after n samples or as soon as the half width of the 95% interval of its SDC
+ *               rate is below w.
+ */
+#include "mc.h"
+#include "detcap_pool.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <unistd.h>
+
+#define MC_MAX_CODINGS 32
+// Batches of one run of the pool, the interval is checked after each run
+#define MC_ROUND 64
+// Quantile of the 95% interval
+#define MC_Z 1.959963985
+
+static const mc_coding_t *codings[MC_MAX_CODINGS];
+static int codingCount = 0;
+
+void mc_register(const mc_coding_t *coding)
+{
+	if (codingCount < MC_MAX_CODINGS) {
+		codings[codingCount++] = coding;
+	}
+}
+
+static int compareCoding(const void *a, const void *b)
+{
+	return strcmp((*(const mc_coding_t **)a)->name,
+		      (*(const mc_coding_t **)b)->name);
+}
+
+// 1 if name is in the comma separated list, no list contains all names
+static int inList(const char *list, const char *name)
+{
+	if (list == NULL) {
+		return 1;
+	}
+	size_t len = strlen(name);
+	const char *p = list;
+	while (p != NULL) {
+		if (strncmp(p, name, len) == 0 &&
+		    (p[len] == ',' || p[len] == 0)) {
+			return 1;
+		}
+		p = strchr(p, ',');
+		if (p != NULL) {
+			p++;
+		}
+	}
+	return 0;
+}
+
+static const char *MODEL_NAME[] = { "trans", "flip", "perm" };
+
+static void usage(void)
+{
+	printf("Usage: detcap-mc [-e codings] [-f trans|flip|perm] [-b bits] [-n samples] [-w width]\n"
+	       "                 [-t threads] [-s seed] [-h]\n");
+	printf("Codings:");
+	for (int c = 0; c < codingCount; c++) {
+		printf(" %s", codings[c]->name);
+	}
+	printf("\n");
+}
+
+struct mc_job {
+	const mc_coding_t *coding;
+	const mc_fault_t *fault;
+	uint64_t firstBatch;
+};
+
+static void mc_task(void *arg, size_t task, uint64_t *counters)
+{
+	struct mc_job *job = arg;
+	job->coding->simulate(job->fault, job->firstBatch + task, counters);
+}
+
+// Wilson score interval of k of n
+static void wilson(uint64_t k, uint64_t n, double *low, double *high)
+{
+	double p = (double)k / n;
+	double z2 = MC_Z * MC_Z;
+	double denom = 1 + z2 / n;
+	double center = (p + z2 / (2.0 * n)) / denom;
+	double half = MC_Z * sqrt(p * (1 - p) / n + z2 / (4.0 * n * n)) / denom;
+	*low = center - half < 0 ? 0 : center - half;
+	*high = center + half > 1 ? 1 : center + half;
+}
+
+int main(int argc, char **argv)
+{
+	const char *codingList = NULL;
+	mc_fault_t fault = { MC_TRANS, 1, 51616u };
+	uint64_t samples = 100 * MC_BATCH;
+	double width = 0;
+	int threads = 0;
+	int opt;
+
+	qsort(codings, codingCount, sizeof(codings[0]), compareCoding);
+	while ((opt = getopt(argc, argv, "e:f:b:n:w:t:s:h")) != -1) {
+		switch (opt) {
+		case 'e':
+			codingList = optarg;
+			break;
+		case 'f':
+			fault.model = -1;
+			for (int m = 0; m < MC_MODELS; m++) {
+				if (strcmp(optarg, MODEL_NAME[m]) == 0) {
+					fault.model = m;
+				}
+			}
+			if (fault.model < 0) {
+				usage();
+				return -1;
+			}
+			break;
+		case 'b':
+			fault.bits = atoi(optarg);
+			break;
+		case 'n':
+			samples = strtoull(optarg, NULL, 10);
+			break;
+		case 'w':
+			width = atof(optarg);
+			break;
+		case 't':
+			threads = atoi(optarg);
+			break;
+		case 's':
+			fault.seed = strtoull(optarg, NULL, 10);
+			break;
+		default:
+			usage();
+			return opt == 'h' ? 0 : -1;
+		}
+	}
+	if (fault.bits < 1) {
+		printf("[Error] The flip model needs at least one bit\n");
+		return -1;
+	}
+	uint64_t batches = (samples + MC_BATCH - 1) / MC_BATCH;
+
+	detcap_pool_t *pool = detcap_pool_create(threads);
+	if (pool == NULL) {
+		printf("[Error] Could not create the thread pool\n");
+		return -1;
+	}
+
+	printf("~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\n");
+	if (fault.model == MC_FLIP) {
+		printf("Monte Carlo SDCs for %d bit flips, seed %lu  \n",
+		       fault.bits, fault.seed);
+	} else {
+		printf("Monte Carlo SDCs for %s faults, seed %lu  \n",
+		       MODEL_NAME[fault.model], fault.seed);
+	}
+	printf("~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\n");
+	printf(" Coding    | Bits |   Samples    |    SDCs     |   Detected   |    Benign    |  SDC rate  |     95%% interval      |\n");
+	printf("-----------+------+--------------+-------------+--------------+--------------+------------+-----------------------+\n");
+	for (int c = 0; c < codingCount; c++) {
+		const mc_coding_t *coding = codings[c];
+		if (!inList(codingList, coding->name)) {
+			continue;
+		}
+		uint64_t total[MC_OUTCOMES] = { 0 };
+		uint64_t n = 0;
+		double low = 0;
+		double high = 1;
+		struct mc_job job = { coding, &fault, 0 };
+		while (job.firstBatch < batches) {
+			uint64_t tasks = batches - job.firstBatch;
+			if (tasks > MC_ROUND) {
+				tasks = MC_ROUND;
+			}
+			uint64_t counters[MC_OUTCOMES];
+			detcap_pool_run(pool, mc_task, &job, tasks, counters,
+					MC_OUTCOMES);
+			for (int o = 0; o < MC_OUTCOMES; o++) {
+				total[o] += counters[o];
+			}
+			n += tasks * MC_BATCH;
+			job.firstBatch += tasks;
+			wilson(total[MC_SDC], n, &low, &high);
+			if (width > 0 && (high - low) / 2 <= width) {
+				break;
+			}
+		}
+		printf(" %-9s | %-4zu | %-12lu | %-11lu | %-12lu | %-12lu | %-10.3e | %-9.3e %-9.3e   |\n",
+		       coding->name, coding->stateSize * 8, n, total[MC_SDC],
+		       total[MC_DETECTED], total[MC_BENIGN],
+		       (double)total[MC_SDC] / n, low, high);
+	}
+	printf("-----------+------+--------------+-------------+--------------+--------------+------------+-----------------------+\n");
+	printf("\n\n\n");
+	detcap_pool_destroy(pool);
+	return 0;
+}
@@ -0,0 +1,59 @@
+/**
+ * @copyright: (c) 2022, Institute for Control Engineering of Machine Tools and Manufacturing Units,
+ *             University of Stuttgart
+ *             All rights reserved. Licensed under the Apache License, Version 2.0 (the "License");
+ *             you may not use this file except in compliance with the License.
+ *             You may obtain a copy of the License at
+ *                  http://www.apache.org/licenses/LICENSE-2.0
+ *             Unless required by applicable law or agreed to in writing, software
+ *             distributed under the License is distributed on an "AS IS" BASIS,
+ *             WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *             See the License for the specific language governing permissions and
+ *             limitations under the License.
+ * @author: Marc Fischer <marc.fischer@isw.uni-stuttgart.de>
+ * @description: Monte Carlo fault simulation of the 32 and 64 bit codings. Each coding is compiled into its own
+ *               object by mc_coding.c and registers itself at the driver mc.c.
+ */
+#ifndef MC_H_
+#define MC_H_ 1
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define MC_STR_(a) #a
+#define MC_STR(a) MC_STR_(a)
+
+// Samples of one task, each task draws from its own PCG stream
+#define MC_BATCH 65536
+
+// Fault models. The state has two words, the separate value and the code word or, for the residue codings, the
+// value and the check of the code word. trans XORs one of the words, chosen at random, with a random mask (all masks
+// as likely, as in detcap trans). flip flips a number of random bits of the whole state, so the bits may hit both
+// words. perm sets each bit of the state stuck with probability 1/2, at a random value (as the masks j and k of
+// detcap perm).
+enum MC_MODEL { MC_TRANS, MC_FLIP, MC_PERM, MC_MODELS };
+
+// Outcome of a fault. Benign faults are accepted by the check and decode to the original value, this includes
+// faults that do not change the state.
+enum MC_OUTCOME { MC_SDC, MC_DETECTED, MC_BENIGN, MC_OUTCOMES };
+
+typedef struct {
+	int model;
+	int bits; //Flipped bits of the flip model
+	uint64_t seed;
+} mc_fault_t;
+
+typedef struct {
+	const char *name; //Name on the command line, e.g. an32
+	const char *encoding; //ENCODING_NAME of the coding
+	int width;
+	size_t stateSize; //Bytes of the faulted state, the code word and the separate value if the check uses it
+	// Simulates MC_BATCH faults with the stream of the batch and adds the outcomes to counters[MC_OUTCOMES]
+	void (*simulate)(const mc_fault_t *fault, uint64_t batch,
+			 uint64_t *counters);
+} mc_coding_t;
+
+// Called by the constructor of each coding
+void mc_register(const mc_coding_t *coding);
+
+#endif //MC_H_
@@ -0,0 +1,138 @@
+/**
+ * @copyright: (c) 2022, Institute for Control Engineering of Machine Tools and Manufacturing Units,
+ *             University of Stuttgart
+ *             All rights reserved. Licensed under the Apache License, Version 2.0 (the "License");
+ *             you may not use this file except in compliance with the License.
+ *             You may obtain a copy of the License at
+ *                  http://www.apache.org/licenses/LICENSE-2.0
+ *             Unless required by applicable law or agreed to in writing, software
+ *             distributed under the License is distributed on an "AS IS" BASIS,
+ *             WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *             See the License for the specific language governing permissions and
+ *             limitations under the License.
+ * @author: Marc Fischer <marc.fischer@isw.uni-stuttgart.de>
+ * @description: Monte Carlo fault simulation of one coding. The coding is selected by the definitions of
+ *               coding_defines.h, MC_NAME gives the name on the command line of the driver.
+ *               The state of a value is its code word and, if the check compares both, the separate value.
+ *               A random operand is encoded, the fault is applied to the bytes of the state and the check and
+ *               decoding of the faulty state give the outcome.
+ */
+#include <stddef.h>
+#include <string.h>
+#include "mc.h"
+#include "helpers.h"
+#include "coding_defines.h"
+#include "pcg_variants.h"
+
+#ifndef MC_NAME
+#error "MC_NAME must be defined"
+#endif
+
+// The residue code word holds the value and its check, the complement and AN checks compare the separate value
+#if defined(RES32) || defined(RES64) || defined(RESBL32) || defined(RESBL64)
+#define MC_SEPARATE 0
+#else
+#define MC_SEPARATE 1
+#endif
+
+#define MC_VAL_SIZE (MC_SEPARATE ? sizeof(TEST_TYPE) : 0)
+#define MC_STATE_SIZE (MC_VAL_SIZE + sizeof(ENC_TYPE))
+// The state has two words, the separate value and the code word or the value and the check of the residue code word.
+// The second word starts at MC_WORD_SPLIT.
+#if MC_SEPARATE
+#define MC_WORD_SPLIT MC_VAL_SIZE
+#else
+#define MC_WORD_SPLIT offsetof(ENC_TYPE, check)
+#endif
+
+static void randomBytes(pcg32_random_t *rng, uint8_t *buf, size_t size)
+{
+	for (size_t i = 0; i < size; i += 4) {
+		uint32_t r = pcg32_random_r(rng);
+		memcpy(buf + i, &r, size - i < 4 ? size - i : 4);
+	}
+}
+
+static void applyFault(const mc_fault_t *fault, pcg32_random_t *rng,
+		       uint8_t *state)
+{
+	uint8_t mask[MC_STATE_SIZE];
+	if (fault->model == MC_TRANS) {
+		//One word, the value or the code word (the check for the residue codings)
+		size_t offset = 0;
+		size_t size = MC_WORD_SPLIT;
+		if (pcg32_boundedrand_r(rng, 2)) {
+			offset = MC_WORD_SPLIT;
+			size = MC_STATE_SIZE - MC_WORD_SPLIT;
+		}
+		randomBytes(rng, mask, size);
+		for (size_t i = 0; i < size; i++) {
+			state[offset + i] ^= mask[i];
+		}
+	} else if (fault->model == MC_FLIP) {
+		int bits = fault->bits;
+		if (bits > (int)MC_STATE_SIZE * 8) {
+			bits = MC_STATE_SIZE * 8;
+		}
+		memset(mask, 0, sizeof(mask));
+		for (int b = 0; b < bits;) {
+			uint32_t pos = pcg32_boundedrand_r(rng, MC_STATE_SIZE * 8);
+			if (!(mask[pos / 8] & (1 << (pos % 8)))) {
+				mask[pos / 8] |= 1 << (pos % 8);
+				b++;
+			}
+		}
+		for (size_t i = 0; i < MC_STATE_SIZE; i++) {
+			state[i] ^= mask[i];
+		}
+	} else {
+		uint8_t value[MC_STATE_SIZE];
+		randomBytes(rng, mask, MC_STATE_SIZE);
+		randomBytes(rng, value, MC_STATE_SIZE);
+		for (size_t i = 0; i < MC_STATE_SIZE; i++) {
+			uint8_t mask0 = mask[i] & ~value[i];
+			uint8_t mask1 = mask[i] & value[i];
+			state[i] = (state[i] & ~mask0) | mask1;
+		}
+	}
+}
+
+static void simulate(const mc_fault_t *fault, uint64_t batch,
+		     uint64_t *counters)
+{
+	pcg32_random_t rng;
+	pcg32_srandom_r(&rng, fault->seed, batch);
+	for (int i = 0; i < MC_BATCH; i++) {
+		TEST_TYPE x;
+		randomBytes(&rng, (uint8_t *)&x, sizeof(x));
+		ENC_TYPE x_enc = ENCODEDFUNCTION(encode)(x);
+
+		uint8_t state[MC_STATE_SIZE];
+		memcpy(state, &x, MC_VAL_SIZE);
+		memcpy(state + MC_VAL_SIZE, &x_enc, sizeof(ENC_TYPE));
+		applyFault(fault, &rng, state);
+		TEST_TYPE fault_x = x;
+		ENC_TYPE fault_x_enc;
+		memcpy(&fault_x, state, MC_VAL_SIZE);
+		memcpy(&fault_x_enc, state + MC_VAL_SIZE, sizeof(ENC_TYPE));
+
+		if (!ENCODEDFUNCTION(check)(fault_x, fault_x_enc)) {
+			counters[MC_DETECTED]++;
+		} else if (ENCODEDFUNCTION(decode)(fault_x_enc) != x) {
+			counters[MC_SDC]++;
+		} else {
+			counters[MC_BENIGN]++;
+		}
+	}
+}
+
+static const mc_coding_t coding = { MC_STR(MC_NAME), ENCODING_NAME, WIDTH,
+				    MC_STATE_SIZE, simulate };
+
+__attribute__((constructor)) static void mc_register_coding(void)
+{
+#ifdef AN64
+	init();
+#endif
+	mc_register(&coding);
+}
@@ -73,6 +73,8 @@ extern "C" {
 #define MAX INT32_MAX
 #define MIN INT32_MIN
 #define WIDTH 32
+#define SOA_TYPE int32c1_soa_t
+#define SOA_TYPE_U uint32c1_soa_t
 #elif RES64
 #include "residue_64.h"
 #define ENC_TYPE_U uint64c1_t
@@ -84,6 +86,8 @@ extern "C" {
 #define MAX INT64_MAX
 #define MIN INT64_MIN
 #define WIDTH 64
+#define SOA_TYPE int64c1_soa_t
+#define SOA_TYPE_U uint64c1_soa_t
 #elif AN32
 #include "an_32.h"
 #define ENC_TYPE_U uint32c1_t
@@ -106,6 +110,95 @@ extern "C" {
 #define MIN INT64_MIN
 #define MAX INT64_MAX
 #define WIDTH 64
+#elif AN32DF
+#include "an_divfree_32.h"
+#define ENC_TYPE_U uint32c1_t
+#define TEST_TYPE_U uint32_t
+#define ENC_TYPE int32c1_t
+#define TEST_TYPE int32_t
+#define ENCODEDFUNCTION(fun) fun##_32c1
+#define ENCODEDFUNCTION_U(fun) u_##fun##_32c1
+#define MIN INT32_MIN
+#define MAX INT32_MAX
+#define WIDTH 32
+#elif AN64DF
+#include "an_divfree_64.h"
+#define ENC_TYPE_U uint64c1_t
+#define TEST_TYPE_U uint64_t
+#define ENC_TYPE int64c1_t
+#define TEST_TYPE int64_t
+#define ENCODEDFUNCTION(fun) fun##_64c1
+#define ENCODEDFUNCTION_U(fun) u_##fun##_64c1
+#define MIN INT64_MIN
+#define MAX INT64_MAX
+#define WIDTH 64
+#elif AN64LIMB
+#include "an_limb_64.h"
+#define ENC_TYPE_U uint64c1_t
+#define TEST_TYPE_U uint64_t
+#define ENC_TYPE int64c1_t
+#define TEST_TYPE int64_t
+#define ENCODEDFUNCTION(fun) fun##_64c1
+#define ENCODEDFUNCTION_U(fun) u_##fun##_64c1
+#define MIN INT64_MIN
+#define MAX INT64_MAX
+#define WIDTH 64
+#elif AN32P
+//AN coding for an arbitrary A, given by the definition AN_A
+#define AN_PARAM_A AN_A
+#define AN_PARAM_SFX 32c1
+#include "an_param_32.h"
+#define ENCODING_NAME "AN_32BIT_A" AC_AN_STR(AN_A)
+#define ENC_TYPE_U uint32c1_t
+#define TEST_TYPE_U uint32_t
+#define ENC_TYPE int32c1_t
+#define TEST_TYPE int32_t
+#define ENCODEDFUNCTION(fun) fun##_32c1
+#define ENCODEDFUNCTION_U(fun) u_##fun##_32c1
+#define MIN INT32_MIN
+#define MAX INT32_MAX
+#define WIDTH 32
+#elif AN64P
+//AN coding for an arbitrary A, given by the definition AN_A
+#define AN_PARAM_A AN_A
+#define AN_PARAM_SFX 64c1
+#include "an_param_64.h"
+#define ENCODING_NAME "AN_64BIT_A" AC_AN_STR(AN_A)
+#define ENC_TYPE_U uint64c1_t
+#define TEST_TYPE_U uint64_t
+#define ENC_TYPE int64c1_t
+#define TEST_TYPE int64_t
+#define ENCODEDFUNCTION(fun) fun##_64c1
+#define ENCODEDFUNCTION_U(fun) u_##fun##_64c1
+#define MIN INT64_MIN
+#define MAX INT64_MAX
+#define WIDTH 64
+#elif RESBL32
+#include "residue_branchless_32.h"
+#define ENC_TYPE_U uint32c1_t
+#define TEST_TYPE_U uint32_t
+#define ENC_TYPE int32c1_t
+#define TEST_TYPE int32_t
+#define ENCODEDFUNCTION(fun) fun##_32c1
+#define ENCODEDFUNCTION_U(fun) u_##fun##_32c1
+#define MIN INT32_MIN
+#define MAX INT32_MAX
+#define WIDTH 32
+#define SOA_TYPE int32c1_soa_t
+#define SOA_TYPE_U uint32c1_soa_t
+#elif RESBL64
+#include "residue_branchless_64.h"
+#define ENC_TYPE_U uint64c1_t
+#define TEST_TYPE_U uint64_t
+#define ENC_TYPE int64c1_t
+#define TEST_TYPE int64_t
+#define ENCODEDFUNCTION(fun) fun##_64c1
+#define ENCODEDFUNCTION_U(fun) u_##fun##_64c1
+#define MIN INT64_MIN
+#define MAX INT64_MAX
+#define WIDTH 64
+#define SOA_TYPE int64c1_soa_t
+#define SOA_TYPE_U uint64c1_soa_t
 #elif NONE32
 #include "none_32.h"
 #define ENC_TYPE_U uint32_t
@@ -130,6 +223,15 @@ extern "C" {
 #define WIDTH 64
 #endif
 
+// Batch versions of the operations, e.g. ENCODEDFUNCTION_N(add) -> add_32c1_n
+#define AC_CONCAT_(a, b) a##b
+#define AC_CONCAT(a, b) AC_CONCAT_(a, b)
+#define ENCODEDFUNCTION_N(fun) AC_CONCAT(ENCODEDFUNCTION(fun), _n)
+#define ENCODEDFUNCTION_U_N(fun) AC_CONCAT(ENCODEDFUNCTION_U(fun), _n)
+// Operations on the struct-of-arrays containers (residue codings), e.g. ENCODEDFUNCTION_SOA(add) -> add_32c1_soa
+#define ENCODEDFUNCTION_SOA(fun) AC_CONCAT(ENCODEDFUNCTION(fun), _soa)
+#define ENCODEDFUNCTION_U_SOA(fun) AC_CONCAT(ENCODEDFUNCTION_U(fun), _soa)
+
 #ifdef __cplusplus
 }
 #endif //__cplusplus
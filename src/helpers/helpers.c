@@ -17,7 +17,12 @@
 #define _GNU_SOURCE
 #include "helpers.h"
 #include <stdio.h>
+#include <string.h>
+#include <errno.h>
 #include <sched.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
 
 //One problem is the value INT32_MIN. If encoding it will result in INT32_MIN. Which leads to errors
 uint32_t testList_int32[TESTLISTSIZE_INT] = { 0,
@@ -269,3 +274,103 @@ int schedutil_pinToCore(pid_t pid, int *pinList, int sizePinList)
 	}
 	return ret;
 }
+
+int perfcount_open(uint32_t type, uint64_t config)
+{
+	struct perf_event_attr attr;
+	memset(&attr, 0, sizeof(attr));
+	attr.size = sizeof(attr);
+	attr.type = type;
+	attr.config = config;
+	attr.exclude_kernel = 1;
+	attr.exclude_hv = 1;
+	int fd = syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+	if (fd < 0) {
+		perror("[warning] Could not open performance counter");
+	}
+	return fd;
+}
+
+uint64_t perfcount_read(int fd)
+{
+	uint64_t val = 0;
+	if (fd < 0 || read(fd, &val, sizeof(val)) != sizeof(val)) {
+		return 0;
+	}
+	return val;
+}
+
+void perfcount_close(int fd)
+{
+	if (fd >= 0) {
+		close(fd);
+	}
+}
+
+int perfgroup_open(perfgroup_t *group, const uint32_t *types,
+		   const uint64_t *configs, int count)
+{
+	int leader = -1;
+	group->count = count < PERFGROUP_MAX ? count : PERFGROUP_MAX;
+	group->opened = 0;
+	for (int i = 0; i < group->count; i++) {
+		struct perf_event_attr attr;
+		memset(&attr, 0, sizeof(attr));
+		attr.size = sizeof(attr);
+		attr.type = types[i];
+		attr.config = configs[i];
+		attr.exclude_kernel = 1;
+		attr.exclude_hv = 1;
+		attr.read_format = PERF_FORMAT_GROUP;
+		group->fd[i] =
+			syscall(SYS_perf_event_open, &attr, 0, -1, leader, 0);
+		if (group->fd[i] < 0) {
+			printf("[warning] Could not open performance counter %d: %s\n",
+			       i, strerror(errno));
+			continue;
+		}
+		if (leader < 0) {
+			leader = group->fd[i];
+		}
+		group->opened++;
+	}
+	return group->opened;
+}
+
+int perfgroup_read(const perfgroup_t *group, uint64_t *vals)
+{
+	//The values are in the order in which the counters were added: nr, value[nr]
+	uint64_t buf[PERFGROUP_MAX + 1];
+	memset(vals, 0, sizeof(uint64_t) * group->count);
+	if (group->opened == 0) {
+		return -1;
+	}
+	int leader = 0;
+	while (group->fd[leader] < 0) {
+		leader++;
+	}
+	ssize_t len = read(group->fd[leader], buf, sizeof(buf));
+	if (len < (ssize_t)sizeof(uint64_t) ||
+	    len < (ssize_t)(sizeof(uint64_t) * (buf[0] + 1))) {
+		return -1;
+	}
+	uint64_t v = 1;
+	for (int i = 0; i < group->count && v <= buf[0]; i++) {
+		if (group->fd[i] >= 0) {
+			vals[i] = buf[v++];
+		}
+	}
+	return 0;
+}
+
+void perfgroup_close(perfgroup_t *group)
+{
+	//Siblings first, the leader is the first opened counter
+	for (int i = group->count - 1; i >= 0; i--) {
+		if (group->fd[i] >= 0) {
+			close(group->fd[i]);
+			group->fd[i] = -1;
+		}
+	}
+	group->opened = 0;
+}
@@ -88,6 +88,27 @@ uint64_t stuckAtBit_uint64(uint64_t val, unsigned int position,
 int schedutil_sched_setFIFO(pid_t pid, unsigned int priority);
 int schedutil_pinToCore(pid_t pid, int *pinList, int sizePinList);
 
+// Hardware counter of the calling thread, type/config as in perf_event_open(2). Returns -1 if not available,
+// reading an unavailable counter returns 0.
+int perfcount_open(uint32_t type, uint64_t config);
+uint64_t perfcount_read(int fd);
+void perfcount_close(int fd);
+
+// Group of hardware counters of the calling thread, read together with one read(2). Counters that are not
+// available are skipped and read as 0.
+#define PERFGROUP_MAX 8
+typedef struct {
+	int fd[PERFGROUP_MAX]; //-1 if the counter is not available
+	int count;
+	int opened;
+} perfgroup_t;
+// Returns the number of opened counters
+int perfgroup_open(perfgroup_t *group, const uint32_t *types,
+		   const uint64_t *configs, int count);
+// Reads group->count values into vals. Returns 0 on success.
+int perfgroup_read(const perfgroup_t *group, uint64_t *vals);
+void perfgroup_close(perfgroup_t *group);
+
 #define TESTLISTSIZE_INT 6
 extern uint32_t testList_int32[TESTLISTSIZE_INT];
 
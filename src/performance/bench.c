@@ -0,0 +1,1254 @@
+/**
+ * @copyright: (c) 2022, Institute for Control Engineering of Machine Tools and Manufacturing Units,
+ *             University of Stuttgart
+ *             All rights reserved. Licensed under the Apache License, Version 2.0 (the "License");
+ *             you may not use this file except in compliance with the License.
+ *             You may obtain a copy of the License at
+ *                  http://www.apache.org/licenses/LICENSE-2.0
+ *             Unless required by applicable law or agreed to in writing, software
+ *             distributed under the License is distributed on an "AS IS" BASIS,
+ *             WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *             See the License for the specific language governing permissions and
+ *             limitations under the License.
+ * @author: Marc Fischer <marc.fischer@isw.uni-stuttgart.de>
+ * @description: Benchmark driver for all codings. Measures the selected operations of the selected codings in
+ *               one process and writes one combined CSV. Usage:
+ *                   performance [-e codings] [-k operations] [-n iterations] [-l values] [-c core]
+ *                               [-p priority] [-i input] [-m tp|lat|both] [-r config] [-o prefix]
+ *                               [-C cachedir] [-w warmup] [-b bootstrap] [-s seed]
+ *                               [-W min[:max]] [-t threads] [-a private|shared] [-L cores] [-h]
+ *                               [rands.dat]
+ *               Codings and operations are comma separated lists of the names printed by -h, default all.
+ *               The input profile (-i) is one of the names printed by -h, the CSVs of a profile other than
+ *               file have its name as suffix.
+ *               The tags of the CSV are named <coding>:TAG_<OPERATION> for the throughput and
+ *               <coding>:TAG_<OPERATION>_LAT for the latency of the operation. The medians of the hardware
+ *               counters of each run are added as columns after MEDIAN, the raw config of the divider
+ *               counter is set with -r.
+ *               rands.dat is the binary file of genrand, it is memory mapped. The 64 bit codings use the 64 bit
+ *               samples. With -C, the encoded inputs of each coding are cached in the directory.
+ *               Each coding runs its operations warmup times before the measurement, the order of the
+ *               operations is shuffled each iteration. The stats CSV has the ns per operation without the time
+ *               of the empty calibration loop and the slowdown to the none coding with bootstrap intervals.
+ *               -W sweeps the working set of the operands x and y from min to max bytes (suffix K, M, G),
+ *               doubling each step, and writes the time per operation of each size to the sweep CSV.
+ *               -t runs the operations on each of the comma separated thread counts at once, pinned to the
+ *               cores of -L, with private or shared inputs (-a), and writes the aggregate throughput to the
+ *               scale CSV.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <errno.h>
+#include <ctype.h>
+#include <unistd.h>
+#include <time.h>
+#include <math.h>
+#include <pthread.h>
+#include <linux/perf_event.h>
+#include "logger.h"
+#include "helpers.h"
+#include "bench.h"
+#include "randfile.h"
+#include "bench_stats.h"
+#include "bench_record.h"
+
+#define BENCH_MAX_CODINGS 64
+
+static const bench_coding_t *codings[BENCH_MAX_CODINGS];
+static int codingCount = 0;
+
+void bench_register(const bench_coding_t *coding)
+{
+	if (codingCount < BENCH_MAX_CODINGS) {
+		codings[codingCount++] = coding;
+	}
+}
+
+static int compareCoding(const void *a, const void *b)
+{
+	return strcmp((*(const bench_coding_t **)a)->name,
+		      (*(const bench_coding_t **)b)->name);
+}
+
+// 1 if name is in the comma separated list, no list contains all names
+static int inList(const char *list, const char *name)
+{
+	if (list == NULL) {
+		return 1;
+	}
+	size_t len = strlen(name);
+	const char *p = list;
+	while (p != NULL) {
+		if (strncmp(p, name, len) == 0 &&
+		    (p[len] == ',' || p[len] == 0)) {
+			return 1;
+		}
+		p = strchr(p, ',');
+		if (p != NULL) {
+			p++;
+		}
+	}
+	return 0;
+}
+
+// One measured pair of coding and operation
+typedef struct {
+	const bench_coding_t *coding;
+	const bench_op_t *op;
+	int mode;
+	uint64_t *counts; //BENCH_COUNTERS values per run
+	double *ns; //Time of each run
+	int runs;
+	int calibration; //Index of the calibration pair of the coding and mode
+	int native; //Index of the same operation of the none coding, -1 if not measured
+} bench_pair_t;
+
+// Hardware counters of each run. The divider has no generic event, the default raw config is
+// ARITH.DIVIDER_ACTIVE of Intel since Skylake (event 0x14, umask 0x01, cmask 1).
+#define BENCH_COUNTERS 6
+#define BENCH_DIV_CONFIG 0x1000114
+static const char *COUNTER_NAME[BENCH_COUNTERS] = {
+	"CYCLES",     "INSTRUCTIONS", "BRANCH_MISSES",
+	"L1D_MISSES", "LLC_MISSES",   "DIV_CYCLES"
+};
+static const uint32_t COUNTER_TYPE[BENCH_COUNTERS] = {
+	PERF_TYPE_HARDWARE, PERF_TYPE_HARDWARE, PERF_TYPE_HARDWARE,
+	PERF_TYPE_HW_CACHE, PERF_TYPE_HW_CACHE, PERF_TYPE_RAW
+};
+#define BENCH_CACHE_MISS(cache)                                                \
+	((cache) | (PERF_COUNT_HW_CACHE_OP_READ << 8) |                        \
+	 (PERF_COUNT_HW_CACHE_RESULT_MISS << 16))
+
+static const char *INPUT_NAME[INPUT_SETS] = { "file", "noov",	"ov",
+					      "small", "edge",	"ovpair",
+					      "sign", "control" };
+static const char *INPUT_SUFFIX[INPUT_SETS] = { "",	 "_noov",  "_ov",
+						"_small", "_edge",  "_ovpair",
+						"_sign", "_control" };
+
+static void usage(void)
+{
+	printf("Usage: performance [-e codings] [-k operations] [-n iterations] [-l values] [-c core]\n"
+	       "                   [-p priority] [-i input] [-m tp|lat|both] [-r config]\n"
+	       "                   [-o prefix] [-C cachedir] [-w warmup] [-b bootstrap] [-s seed]\n"
+	       "                   [-W min[:max]] [-t threads] [-a private|shared] [-L cores] [-h]\n"
+	       "                   [rands.dat]\n");
+	printf("Codings:");
+	const bench_coding_t *most = codings[0];
+	for (int c = 0; c < codingCount; c++) {
+		printf(" %s", codings[c]->name);
+		if (codings[c]->opCount > most->opCount) {
+			most = codings[c];
+		}
+	}
+	//Not every coding has all operations, e.g. the SoA operations are only available for residue codes
+	printf("\nOperations:");
+	for (size_t o = 0; most != NULL && o < most->opCount; o++) {
+		printf(" %s", most->ops[o].name);
+	}
+	printf("\nInputs:");
+	for (int s = INPUT_FILE; s < INPUT_SETS; s++) {
+		printf(" %s", INPUT_NAME[s]);
+	}
+	printf("\n");
+}
+
+// Tag of each pair: <coding>:TAG_<OPERATION>_START/END
+static logger_tagDef_t *makeLoggerDef(const bench_pair_t *pairs, int count)
+{
+	logger_tagDef_t *def = malloc(sizeof(logger_tagDef_t) * count * 2);
+	for (int p = 0; p < count; p++) {
+		char op[64];
+		size_t len = strlen(pairs[p].op->name);
+		for (size_t i = 0; i <= len && i < sizeof(op); i++) {
+			op[i] = toupper((unsigned char)pairs[p].op->name[i]);
+		}
+		op[sizeof(op) - 1] = 0;
+		const char *mode = pairs[p].mode == BENCH_LATENCY ? "_LAT" : "";
+		def[2 * p].tag = 2 * p;
+		snprintf(def[2 * p].info, sizeof(def[0].info),
+			 "%s:TAG_%s%s_START", pairs[p].coding->name, op, mode);
+		def[2 * p + 1].tag = 2 * p + 1;
+		snprintf(def[2 * p + 1].info, sizeof(def[0].info),
+			 "%s:TAG_%s%s_END", pairs[p].coding->name, op, mode);
+	}
+	return def;
+}
+
+static const char *MODE_NAME[] = { "tp", "lat" };
+
+static int compareCount(const void *a, const void *b)
+{
+	uint64_t x = *(const uint64_t *)a, y = *(const uint64_t *)b;
+	return (x > y) - (x < y);
+}
+
+// Median of the counter k over all runs of a pair
+static uint64_t counterMedian(const bench_pair_t *pair, int k, uint64_t *tmp)
+{
+	if (pair->runs == 0) {
+		return 0;
+	}
+	for (int t = 0; t < pair->runs; t++) {
+		tmp[t] = pair->counts[t * BENCH_COUNTERS + k];
+	}
+	qsort(tmp, pair->runs, sizeof(uint64_t), compareCount);
+	return tmp[pair->runs / 2];
+}
+
+// The CSV of the logger only has the timings. Adds the medians of the counters to each row, the rows are
+// matched by their tag. Counters that are not available are written as nan.
+static void appendCounters(const char *filename, const bench_pair_t *pairs,
+			   int pairCount, const logger_tagDef_t *tagdef,
+			   const perfgroup_t *group, int num_tests)
+{
+	FILE *pFile = fopen(filename, "r");
+	if (!pFile) {
+		printf("[Error] Could not open files: %s\n", strerror(errno));
+		return;
+	}
+	char **lines = NULL;
+	int lineCount = 0;
+	char buffer[512];
+	while (fgets(buffer, sizeof(buffer), pFile)) {
+		buffer[strcspn(buffer, "\r\n")] = 0;
+		lines = realloc(lines, sizeof(char *) * (lineCount + 1));
+		lines[lineCount++] = strdup(buffer);
+	}
+	fclose(pFile);
+
+	pFile = fopen(filename, "w");
+	if (!pFile) {
+		printf("[Error] Could not open files: %s\n", strerror(errno));
+		return;
+	}
+	uint64_t *tmp = malloc(sizeof(uint64_t) * num_tests);
+	char tag[300];
+	int p = 0;
+	for (int l = 0; l < lineCount; l++) {
+		fprintf(pFile, "%s", lines[l]);
+		if (l == 0) {
+			for (int k = 0; k < BENCH_COUNTERS; k++) {
+				fprintf(pFile, ";%s", COUNTER_NAME[k]);
+			}
+		} else {
+			//The rows are usually in the order of the pairs
+			size_t len = strcspn(lines[l], ";");
+			int n;
+			for (n = 0; n < pairCount; n++) {
+				int q = (p + n) % pairCount;
+				snprintf(tag, sizeof(tag), "%s-%s",
+					 tagdef[2 * q].info,
+					 tagdef[2 * q + 1].info);
+				if (strlen(tag) == len &&
+				    strncmp(tag, lines[l], len) == 0) {
+					p = q;
+					break;
+				}
+			}
+			for (int k = 0; k < BENCH_COUNTERS; k++) {
+				if (n == pairCount || group->fd[k] < 0) {
+					fprintf(pFile, ";nan");
+				} else {
+					fprintf(pFile, ";%lu",
+						counterMedian(&pairs[p], k,
+							      tmp));
+				}
+			}
+		}
+		fprintf(pFile, "\n");
+		free(lines[l]);
+	}
+	fclose(pFile);
+	free(tmp);
+	free(lines);
+}
+
+static void runPair(const bench_pair_t *pair, void *state)
+{
+	if (pair->mode == BENCH_LATENCY) {
+		pair->op->latency(state);
+	} else {
+		pair->op->throughput(state);
+	}
+}
+
+// Sets the calibration and native reference of each pair
+static void findReferences(bench_pair_t *pairs, int pairCount)
+{
+	for (int p = 0; p < pairCount; p++) {
+		pairs[p].calibration = p;
+		pairs[p].native = -1;
+		for (int q = 0; q < pairCount; q++) {
+			if (pairs[q].mode != pairs[p].mode) {
+				continue;
+			}
+			//Batch operations have no loop of scalar operations
+			if (pairs[q].coding == pairs[p].coding &&
+			    pairs[p].op->latency != NULL &&
+			    strcmp(pairs[q].op->name, BENCH_CALIBRATION) == 0) {
+				pairs[p].calibration = q;
+			}
+			if (strncmp(pairs[q].coding->name, "none", 4) == 0 &&
+			    pairs[q].coding->width == pairs[p].coding->width &&
+			    strcmp(pairs[q].op->name, pairs[p].op->name) == 0) {
+				pairs[p].native = q;
+			}
+		}
+	}
+}
+
+// Bootstrap samples of the time per operation of a pair, optionally without the time of its calibration
+static void bootstrapPair(const bench_pair_t *pairs, int p, double *est,
+			  int bootstrap, uint64_t count, int calibrate,
+			  uint64_t *seed)
+{
+	const bench_pair_t *pair = &pairs[p];
+	bench_bootstrapMedian(pair->ns, pair->runs, est, bootstrap, seed);
+	if (!calibrate || pair->calibration == p) {
+		for (int b = 0; b < bootstrap; b++) {
+			est[b] /= count;
+		}
+		return;
+	}
+	const bench_pair_t *cal = &pairs[pair->calibration];
+	double *calEst = malloc(sizeof(double) * bootstrap);
+	bench_bootstrapMedian(cal->ns, cal->runs, calEst, bootstrap, seed);
+	for (int b = 0; b < bootstrap; b++) {
+		est[b] = (est[b] - calEst[b]) / count;
+	}
+	free(calEst);
+}
+
+// Point estimate as bootstrapPair with the measured runs
+static double estimatePair(const bench_pair_t *pairs, int p, uint64_t count,
+			   int calibrate)
+{
+	const bench_pair_t *pair = &pairs[p];
+	const bench_pair_t *cal = &pairs[pair->calibration];
+	double *tmp = malloc(sizeof(double) * pair->runs);
+	memcpy(tmp, pair->ns, sizeof(double) * pair->runs);
+	double est = bench_median(tmp, pair->runs);
+	if (calibrate && pair->calibration != p) {
+		memcpy(tmp, cal->ns, sizeof(double) * cal->runs);
+		est -= bench_median(tmp, cal->runs);
+	}
+	free(tmp);
+	return est / count;
+}
+
+// Statistics of a pair, written to the stats CSV and the result record. nan if not available.
+typedef struct {
+	double ns;
+	double nsLow;
+	double nsHigh;
+	double slowdown;
+	double slowdownLow;
+	double slowdownHigh;
+} bench_result_t;
+
+// The time per operation without the calibration and the slowdown to the none coding of the same width, each
+// with the 95% percentile bootstrap interval. The calibration itself and the batch operations are not
+// corrected. The slowdown is the ratio of the uncorrected times: the corrected time of a native operation is
+// often below the resolution, so a ratio of corrected times would be dominated by noise.
+static void computeStats(const bench_pair_t *pairs, int pairCount,
+			 uint64_t count, int bootstrap, uint64_t seed,
+			 bench_result_t *results)
+{
+	double *est = malloc(sizeof(double) * (bootstrap > 0 ? bootstrap : 1));
+	double *nativeEst =
+		malloc(sizeof(double) * (bootstrap > 0 ? bootstrap : 1));
+	for (int p = 0; p < pairCount; p++) {
+		const bench_pair_t *pair = &pairs[p];
+		bench_result_t *result = &results[p];
+		result->ns = result->nsLow = result->nsHigh = NAN;
+		result->slowdown = result->slowdownLow = result->slowdownHigh =
+			NAN;
+		if (pair->runs == 0 || bootstrap <= 0) {
+			continue;
+		}
+		result->ns = estimatePair(pairs, p, count, 1);
+		bootstrapPair(pairs, p, est, bootstrap, count, 1, &seed);
+		bench_interval(est, bootstrap, 0.95, &result->nsLow,
+			       &result->nsHigh);
+		if (pair->native >= 0 && pairs[pair->native].runs > 0 &&
+		    strcmp(pair->op->name, BENCH_CALIBRATION) != 0) {
+			result->slowdown =
+				estimatePair(pairs, p, count, 0) /
+				estimatePair(pairs, pair->native, count, 0);
+			bootstrapPair(pairs, p, est, bootstrap, count, 0, &seed);
+			bootstrapPair(pairs, pair->native, nativeEst, bootstrap,
+				      count, 0, &seed);
+			for (int b = 0; b < bootstrap; b++) {
+				nativeEst[b] = est[b] / nativeEst[b];
+			}
+			bench_interval(nativeEst, bootstrap, 0.95,
+				       &result->slowdownLow,
+				       &result->slowdownHigh);
+		}
+	}
+	free(est);
+	free(nativeEst);
+}
+
+static void writeStats(const char *filename, const bench_pair_t *pairs,
+		       int pairCount, const bench_result_t *results)
+{
+	FILE *pFile = fopen(filename, "w");
+	if (!pFile) {
+		printf("[Error] Could not open files: %s\n", strerror(errno));
+		return;
+	}
+	fprintf(pFile, "CODING;ENCODING;OPERATION;MODE;RUNS;NS_PER_OP;NS_PER_OP_LOW;NS_PER_OP_HIGH;"
+		       "SLOWDOWN;SLOWDOWN_LOW;SLOWDOWN_HIGH\n");
+	for (int p = 0; p < pairCount; p++) {
+		const bench_pair_t *pair = &pairs[p];
+		const bench_result_t *result = &results[p];
+		if (isnan(result->ns)) {
+			continue;
+		}
+		fprintf(pFile, "%s;%s;%s;%s;%d;%f;%f;%f;%f;%f;%f\n",
+			pair->coding->name, pair->coding->encoding,
+			pair->op->name, MODE_NAME[pair->mode], pair->runs,
+			result->ns, result->nsLow, result->nsHigh,
+			result->slowdown, result->slowdownLow,
+			result->slowdownHigh);
+	}
+	fclose(pFile);
+}
+
+// Parameters of the run in the result record
+typedef struct {
+	const char *file; //Input file
+	uint64_t checksum; //Checksum of the input file
+	int input_set;
+	int num_tests;
+	uint64_t count; //Operations per run
+	const int *modes;
+	int warmup;
+	int bootstrap;
+	uint64_t seed;
+	int core;
+	int priority;
+} bench_run_t;
+
+// Writes the self describing record of the run: host, build, parameters and the statistics and the time per
+// operation of each run of each pair
+static void writeRecord(const char *filename, const bench_host_t *host,
+			const bench_run_t *run, const bench_pair_t *pairs,
+			int pairCount, const bench_result_t *results)
+{
+	FILE *pFile = fopen(filename, "w");
+	if (!pFile) {
+		printf("[Error] Could not open files: %s\n", strerror(errno));
+		return;
+	}
+	fprintf(pFile, "{\n  \"format\": \"%s\",\n  \"version\": %d,\n",
+		BENCH_RECORD_FORMAT, BENCH_RECORD_VERSION);
+	bench_jsonHost(pFile, host);
+	fprintf(pFile, "  \"run\": {\n    \"date\": ");
+	bench_jsonString(pFile, host->date);
+	fprintf(pFile, ",\n    \"file\": ");
+	bench_jsonString(pFile, run->file);
+	fprintf(pFile, ",\n    \"checksum\": \"%016lx\",\n", run->checksum);
+	fprintf(pFile, "    \"input\": \"%s\",\n", INPUT_NAME[run->input_set]);
+	fprintf(pFile, "    \"iterations\": %d,\n", run->num_tests);
+	fprintf(pFile, "    \"values\": %lu,\n", run->count);
+	fprintf(pFile, "    \"modes\": [%s%s%s],\n",
+		run->modes[BENCH_THROUGHPUT] ? "\"tp\"" : "",
+		run->modes[BENCH_THROUGHPUT] && run->modes[BENCH_LATENCY] ? ", " :
+									    "",
+		run->modes[BENCH_LATENCY] ? "\"lat\"" : "");
+	fprintf(pFile, "    \"warmup\": %d,\n", run->warmup);
+	fprintf(pFile, "    \"bootstrap\": %d,\n", run->bootstrap);
+	fprintf(pFile, "    \"seed\": %lu,\n", run->seed);
+	fprintf(pFile, "    \"core\": %d,\n", run->core);
+	fprintf(pFile, "    \"priority\": %d\n  },\n", run->priority);
+	fprintf(pFile, "  \"results\": [");
+	for (int p = 0; p < pairCount; p++) {
+		const bench_pair_t *pair = &pairs[p];
+		const bench_result_t *result = &results[p];
+		fprintf(pFile, "%s\n    {\"coding\": ", p ? "," : "");
+		bench_jsonString(pFile, pair->coding->name);
+		fprintf(pFile, ", \"encoding\": ");
+		bench_jsonString(pFile, pair->coding->encoding);
+		fprintf(pFile, ", \"operation\": ");
+		bench_jsonString(pFile, pair->op->name);
+		fprintf(pFile, ", \"mode\": \"%s\", \"runs\": %d",
+			MODE_NAME[pair->mode], pair->runs);
+		const char *names[] = { "ns_per_op",	 "ns_per_op_low",
+					"ns_per_op_high", "slowdown",
+					"slowdown_low",	 "slowdown_high" };
+		const double values[] = { result->ns,	    result->nsLow,
+					  result->nsHigh,   result->slowdown,
+					  result->slowdownLow,
+					  result->slowdownHigh };
+		for (int v = 0; v < 6; v++) {
+			fprintf(pFile, ", \"%s\": ", names[v]);
+			bench_jsonNumber(pFile, values[v]);
+		}
+		//Uncorrected time per operation of each run in the order of the runs
+		fprintf(pFile, ",\n     \"samples\": [");
+		for (int t = 0; t < pair->runs; t++) {
+			fprintf(pFile, t ? ", %.4g" : "%.4g",
+				pair->ns[t] / run->count);
+		}
+		fprintf(pFile, "]}");
+	}
+	fprintf(pFile, "\n  ]\n}\n");
+	fclose(pFile);
+}
+
+// Size with the suffix K, M or G
+static size_t parseSize(const char *str, char **end)
+{
+	size_t size = strtoull(str, end, 10);
+	switch (**end) {
+	case 'G':
+		size <<= 10;
+		//fall through
+	case 'M':
+		size <<= 10;
+		//fall through
+	case 'K':
+		size <<= 10;
+		(*end)++;
+		break;
+	}
+	return size;
+}
+
+// Operations per run in the sweep, small working sets are repeated to reach it
+#define BENCH_SWEEP_OPS (1 << 20)
+
+// Measures the pairs for working sets from minSize to maxSize bytes, doubling the size each step. The working
+// set is the operands x and y, so each coding gets its own number of code words for a size.
+static int runSweep(const char *filename, bench_pair_t *pairs, int pairCount,
+		    bench_input_t input, size_t minSize, size_t maxSize,
+		    int num_tests, int warmup, int bootstrap, uint64_t seed)
+{
+	FILE *pFile = fopen(filename, "w");
+	if (!pFile) {
+		printf("[Error] Could not open files: %s\n", strerror(errno));
+		return -2;
+	}
+	fprintf(pFile, "CODING;ENCODING;OPERATION;MODE;WORKING_SET;COUNT;REPS;NS_PER_OP;NS_PER_OP_LOW;"
+		       "NS_PER_OP_HIGH;MOPS\n");
+	int ret = 0;
+	int *order = malloc(sizeof(int) * pairCount);
+	double *est = malloc(sizeof(double) * bootstrap);
+	for (int first = 0; first < pairCount;) {
+		const bench_coding_t *coding = pairs[first].coding;
+		int last = first;
+		while (last < pairCount && pairs[last].coding == coding) {
+			last++;
+		}
+		for (size_t size = minSize; size <= maxSize; size *= 2) {
+			input.count = size / (2 * coding->encSize);
+			if (input.count == 0) {
+				continue;
+			}
+			size_t reps = (BENCH_SWEEP_OPS + input.count - 1) /
+				      input.count;
+			printf("[info] %s: working set %zu bytes, %zu code words x %zu\n",
+			       coding->name, size, input.count, reps);
+			void *state = coding->setup(&input);
+			if (!state) {
+				printf("[Error] Could not allocate the inputs of %s\n",
+				       coding->name);
+				ret = -3;
+				break;
+			}
+			for (int t = 0; t < warmup; t++) {
+				for (int p = first; p < last; p++) {
+					runPair(&pairs[p], state);
+				}
+			}
+			for (int p = first; p < last; p++) {
+				order[p - first] = p;
+				pairs[p].runs = 0;
+			}
+			for (int t = 0; t < num_tests; t++) {
+				bench_shuffle(order, last - first, &seed);
+				for (int o = 0; o < last - first; o++) {
+					int p = order[o];
+					struct timespec ts_start, ts_end;
+					clock_gettime(CLOCK_MONOTONIC, &ts_start);
+					for (size_t r = 0; r < reps; r++) {
+						runPair(&pairs[p], state);
+					}
+					clock_gettime(CLOCK_MONOTONIC, &ts_end);
+					pairs[p].ns[t] =
+						(ts_end.tv_sec - ts_start.tv_sec) * 1e9 +
+						(ts_end.tv_nsec - ts_start.tv_nsec);
+					pairs[p].runs++;
+				}
+			}
+			if (coding->teardown(state) != 0) {
+				printf("[Warning] Check of the encoded inputs of %s failed\n",
+				       coding->name);
+				ret = 1;
+			}
+			//Time per operation including the loop, the memory accesses are part of the result
+			for (int p = first; p < last; p++) {
+				double low = 0, high = 0;
+				uint64_t ops = input.count * reps;
+				double value = estimatePair(pairs, p, ops, 0);
+				if (bootstrap > 0) {
+					bootstrapPair(pairs, p, est, bootstrap,
+						      ops, 0, &seed);
+					bench_interval(est, bootstrap, 0.95,
+						       &low, &high);
+				}
+				fprintf(pFile, "%s;%s;%s;%s;%zu;%zu;%zu;%f;%f;%f;%f\n",
+					coding->name, coding->encoding,
+					pairs[p].op->name,
+					MODE_NAME[pairs[p].mode], size,
+					input.count, reps, value, low, high,
+					1e3 / value);
+			}
+		}
+		first = last;
+	}
+	free(est);
+	free(order);
+	fclose(pFile);
+	return ret;
+}
+
+#define BENCH_MAX_THREADS 64
+
+// Parses a comma separated list of numbers, returns the number of entries
+static int parseList(const char *str, int *list, int max)
+{
+	int count = 0;
+	char *end;
+	while (count < max && *str) {
+		list[count++] = strtol(str, &end, 10);
+		if (*end != ',') {
+			break;
+		}
+		str = end + 1;
+	}
+	return count;
+}
+
+static int compareInt(const void *a, const void *b)
+{
+	return *(const int *)a - *(const int *)b;
+}
+
+// Thread configuration of the scaling mode: the threads are pinned to cores[t]
+typedef struct {
+	const char *name;
+	int threads;
+	int cores[BENCH_MAX_THREADS];
+} bench_config_t;
+
+// Worker of the scaling mode. All workers run the same pair between the two barriers.
+typedef struct {
+	pthread_t thread;
+	int core;
+	void *state; //Own inputs or the shared inputs
+	const bench_input_t *input;
+	const bench_coding_t *coding;
+	double *ns; //Time of each run, indexed by pair * num_tests + run
+	int num_tests;
+} bench_worker_t;
+
+// Job of all workers, set by the main thread before the start barrier
+static struct {
+	pthread_barrier_t start, end;
+	pthread_mutex_t setup;
+	const bench_pair_t *pairs;
+	int pair; //-1 to stop the workers
+	int run;
+	int setupFailed;
+} job;
+
+static void *runWorker(void *arg)
+{
+	bench_worker_t *worker = arg;
+	schedutil_pinToCore(0, &worker->core, 1);
+	//Private inputs are encoded by the worker, so the pages are local to its core. The setup of the codings is
+	//not thread safe.
+	if (worker->state == NULL) {
+		pthread_mutex_lock(&job.setup);
+		worker->state = worker->coding->setup(worker->input);
+		job.setupFailed |= worker->state == NULL;
+		pthread_mutex_unlock(&job.setup);
+	}
+	pthread_barrier_wait(&job.end);
+	while (1) {
+		pthread_barrier_wait(&job.start);
+		int p = job.pair;
+		if (p < 0) {
+			break;
+		}
+		struct timespec ts_start, ts_end;
+		clock_gettime(CLOCK_MONOTONIC, &ts_start);
+		if (!job.setupFailed) {
+			runPair(&job.pairs[p], worker->state);
+		}
+		clock_gettime(CLOCK_MONOTONIC, &ts_end);
+		if (job.run >= 0) {
+			worker->ns[p * worker->num_tests + job.run] =
+				(ts_end.tv_sec - ts_start.tv_sec) * 1e9 +
+				(ts_end.tv_nsec - ts_start.tv_nsec);
+		}
+		pthread_barrier_wait(&job.end);
+	}
+	return NULL;
+}
+
+// Runs pair p on all workers, run is -1 for the warmup and p is -1 to stop the workers. Returns the wall time from the start of the first
+// to the end of the last worker.
+static double runJob(int p, int run)
+{
+	struct timespec ts_start, ts_end;
+	job.pair = p;
+	job.run = run;
+	clock_gettime(CLOCK_MONOTONIC, &ts_start);
+	pthread_barrier_wait(&job.start);
+	//The workers stop without the end barrier
+	if (p >= 0) {
+		pthread_barrier_wait(&job.end);
+	}
+	clock_gettime(CLOCK_MONOTONIC, &ts_end);
+	return (ts_end.tv_sec - ts_start.tv_sec) * 1e9 +
+	       (ts_end.tv_nsec - ts_start.tv_nsec);
+}
+
+// First logical core of the list of cpu that is not cpu itself, -1 without SMT
+static int smtSibling(int cpu)
+{
+	char name[128];
+	sprintf(name, "/sys/devices/system/cpu/cpu%d/topology/thread_siblings_list",
+		cpu);
+	FILE *pFile = fopen(name, "r");
+	if (!pFile) {
+		return -1;
+	}
+	int sibling = -1, first, last;
+	char sep;
+	//The list has the form 0,4 or 0-1
+	while (sibling < 0 && fscanf(pFile, "%d", &first) == 1) {
+		last = first;
+		if (fscanf(pFile, "%c", &sep) == 1 && sep == '-' &&
+		    fscanf(pFile, "%d", &last) == 1) {
+			fscanf(pFile, "%c", &sep);
+		}
+		for (int c = first; c <= last && sibling < 0; c++) {
+			if (c != cpu) {
+				sibling = c;
+			}
+		}
+	}
+	fclose(pFile);
+	return sibling;
+}
+
+// One configuration per thread count on the first cores of the pin list, the default list is all online
+// cores. The smt configuration runs two threads on the first core and its SMT sibling, compared to two
+// threads on two cores it shows the interference of the siblings.
+static int makeConfigs(bench_config_t *configs, int *threadList,
+		       int threadCount, const int *pinList, int pinCount)
+{
+	int cores[BENCH_MAX_THREADS];
+	if (pinCount == 0) {
+		pinCount = sysconf(_SC_NPROCESSORS_ONLN);
+		pinCount = pinCount < BENCH_MAX_THREADS ? pinCount :
+							  BENCH_MAX_THREADS;
+		for (int c = 0; c < pinCount; c++) {
+			cores[c] = c;
+		}
+	} else {
+		memcpy(cores, pinList, sizeof(int) * pinCount);
+	}
+	//The smallest thread count is the reference of the speedup
+	qsort(threadList, threadCount, sizeof(int), compareInt);
+	int count = 0;
+	for (int t = 0; t < threadCount; t++) {
+		int n = threadList[t];
+		if (n < 1 || n > BENCH_MAX_THREADS) {
+			continue;
+		}
+		if (n > pinCount) {
+			printf("[Warning] %d threads on %d cores\n", n,
+			       pinCount);
+		}
+		configs[count].name = "cores";
+		configs[count].threads = n;
+		for (int w = 0; w < n; w++) {
+			configs[count].cores[w] = cores[w % pinCount];
+		}
+		count++;
+	}
+	int sibling = smtSibling(cores[0]);
+	if (sibling >= 0) {
+		configs[count].name = "smt";
+		configs[count].threads = 2;
+		configs[count].cores[0] = cores[0];
+		configs[count].cores[1] = sibling;
+		count++;
+	}
+	return count;
+}
+
+// Measures the pairs of each coding on all thread configurations. Each worker runs the whole loop of the
+// operation on its inputs, the wall time of all workers gives the aggregate throughput. The speedup is
+// relative to the throughput per thread of the first configuration, the smallest thread count. THREAD_CV
+// is the coefficient of variation of the median times of the workers.
+static int runScaling(const char *filename, bench_pair_t *pairs,
+		      int pairCount, const bench_input_t *input,
+		      const bench_config_t *configs, int configCount,
+		      int shared, int num_tests, int warmup, uint64_t seed)
+{
+	FILE *pFile = fopen(filename, "w");
+	if (!pFile) {
+		printf("[Error] Could not open files: %s\n", strerror(errno));
+		return -2;
+	}
+	fprintf(pFile, "CODING;ENCODING;OPERATION;MODE;CONFIG;THREADS;CORES;INPUTS;NS_PER_OP;MOPS_TOTAL;"
+		       "SPEEDUP;THREAD_CV\n");
+	int ret = 0;
+	int *order = malloc(sizeof(int) * pairCount);
+	double *base = malloc(sizeof(double) * pairCount);
+	double *tmp = malloc(sizeof(double) * num_tests);
+	bench_worker_t *workers = malloc(sizeof(bench_worker_t) * BENCH_MAX_THREADS);
+	for (int w = 0; w < BENCH_MAX_THREADS; w++) {
+		workers[w].ns = malloc(sizeof(double) * pairCount * num_tests);
+		workers[w].num_tests = num_tests;
+		workers[w].input = input;
+	}
+	pthread_mutex_init(&job.setup, NULL);
+	job.pairs = pairs;
+	for (int first = 0; first < pairCount && ret >= 0;) {
+		const bench_coding_t *coding = pairs[first].coding;
+		int last = first;
+		while (last < pairCount && pairs[last].coding == coding) {
+			last++;
+		}
+		void *sharedState = NULL;
+		if (shared) {
+			sharedState = coding->setup(input);
+			if (!sharedState) {
+				printf("[Error] Could not allocate the inputs of %s\n",
+				       coding->name);
+				ret = -3;
+				break;
+			}
+		}
+		for (int c = 0; c < configCount; c++) {
+			const bench_config_t *config = &configs[c];
+			int n = config->threads;
+			printf("[info] %s: %s with %d threads\n", coding->name,
+			       config->name, n);
+			pthread_barrier_init(&job.start, NULL, n + 1);
+			pthread_barrier_init(&job.end, NULL, n + 1);
+			job.setupFailed = 0;
+			for (int w = 0; w < n; w++) {
+				workers[w].core = config->cores[w];
+				workers[w].coding = coding;
+				workers[w].state = sharedState;
+				pthread_create(&workers[w].thread, NULL,
+					       runWorker, &workers[w]);
+			}
+			//Waits for the setup of the workers
+			pthread_barrier_wait(&job.end);
+			for (int t = 0; t < warmup; t++) {
+				for (int p = first; p < last; p++) {
+					runJob(p, -1);
+				}
+			}
+			for (int p = first; p < last; p++) {
+				order[p - first] = p;
+				pairs[p].runs = 0;
+			}
+			for (int t = 0; t < num_tests; t++) {
+				bench_shuffle(order, last - first, &seed);
+				for (int o = 0; o < last - first; o++) {
+					int p = order[o];
+					pairs[p].ns[t] = runJob(p, t);
+					pairs[p].runs++;
+				}
+			}
+			runJob(-1, -1);
+			for (int w = 0; w < n; w++) {
+				pthread_join(workers[w].thread, NULL);
+				if (!shared && workers[w].state &&
+				    coding->teardown(workers[w].state) != 0) {
+					printf("[Warning] Check of the encoded inputs of %s failed\n",
+					       coding->name);
+					ret = 1;
+				}
+			}
+			pthread_barrier_destroy(&job.start);
+			pthread_barrier_destroy(&job.end);
+			if (job.setupFailed) {
+				printf("[Error] Could not allocate the inputs of %s\n",
+				       coding->name);
+				ret = -3;
+				break;
+			}
+
+			char cores[BENCH_MAX_THREADS * 4 + 1] = "";
+			for (int w = 0; w < n; w++) {
+				sprintf(cores + strlen(cores), w ? ",%d" : "%d",
+					config->cores[w]);
+			}
+			for (int p = first; p < last; p++) {
+				//Median of each worker, their mean and deviation give the variance between threads
+				double mean = 0, sq = 0, perThread = 0;
+				for (int w = 0; w < n; w++) {
+					memcpy(tmp, &workers[w].ns[p * num_tests],
+					       sizeof(double) * num_tests);
+					double median = bench_median(tmp, num_tests);
+					mean += median;
+					sq += median * median;
+				}
+				mean /= n;
+				double var = sq / n - mean * mean;
+				perThread = mean / input->count;
+				double wall = bench_median(pairs[p].ns, num_tests);
+				double mops = 1e3 * n * input->count / wall;
+				if (c == 0) {
+					//Throughput of one thread of the smallest thread count
+					base[p] = mops / n;
+				}
+				fprintf(pFile, "%s;%s;%s;%s;%s;%d;%s;%s;%f;%f;%f;%f\n",
+					coding->name, coding->encoding,
+					pairs[p].op->name,
+					MODE_NAME[pairs[p].mode], config->name,
+					n, cores, shared ? "shared" : "private",
+					perThread, mops, mops / base[p],
+					var > 0 ? sqrt(var) / mean : 0);
+			}
+		}
+		if (shared && coding->teardown(sharedState) != 0) {
+			printf("[Warning] Check of the encoded inputs of %s failed\n",
+			       coding->name);
+			ret = 1;
+		}
+		first = last;
+	}
+	pthread_mutex_destroy(&job.setup);
+	for (int w = 0; w < BENCH_MAX_THREADS; w++) {
+		free(workers[w].ns);
+	}
+	free(workers);
+	free(tmp);
+	free(base);
+	free(order);
+	fclose(pFile);
+	return ret;
+}
+
+int main(int argc, char **argv)
+{
+	const char *codingList = NULL;
+	const char *opList = NULL;
+	const char *prefix = "all";
+	const char *cacheDir = NULL;
+	int num_tests = 500;
+	size_t test_count = 250000;
+	int core = 3;
+	int priority = 99;
+	int input_set = INPUT_FILE;
+	int modes[] = { 1, 1 }; //Measured modes, default both
+	uint64_t divConfig = BENCH_DIV_CONFIG;
+	int warmup = 10;
+	size_t sweepMin = 0, sweepMax = 0;
+	char *end;
+	int bootstrap = 1000;
+	uint64_t seed = 1;
+	int threadList[BENCH_MAX_THREADS], threadCount = 0;
+	int pinList[BENCH_MAX_THREADS], pinCount = 0;
+	int sharedInputs = 0;
+	int opt;
+
+	qsort(codings, codingCount, sizeof(codings[0]), compareCoding);
+	while ((opt = getopt(argc, argv, "e:k:n:l:c:p:i:m:r:o:C:w:b:s:W:t:a:L:h")) != -1) {
+		switch (opt) {
+		case 'e':
+			codingList = optarg;
+			break;
+		case 'k':
+			opList = optarg;
+			break;
+		case 'n':
+			num_tests = atoi(optarg);
+			break;
+		case 'l':
+			test_count = strtoul(optarg, NULL, 10);
+			break;
+		case 'c':
+			core = atoi(optarg);
+			break;
+		case 'p':
+			priority = atoi(optarg);
+			break;
+		case 'i':
+			for (int s = INPUT_FILE; s < INPUT_SETS; s++) {
+				if (strcmp(optarg, INPUT_NAME[s]) == 0) {
+					input_set = s;
+				}
+			}
+			break;
+		case 'm':
+			modes[BENCH_THROUGHPUT] = strcmp(optarg, "lat") != 0;
+			modes[BENCH_LATENCY] = strcmp(optarg, "tp") != 0;
+			break;
+		case 'r':
+			divConfig = strtoull(optarg, NULL, 0);
+			break;
+		case 'o':
+			prefix = optarg;
+			break;
+		case 'C':
+			cacheDir = optarg;
+			break;
+		case 'w':
+			warmup = atoi(optarg);
+			break;
+		case 'b':
+			bootstrap = atoi(optarg);
+			break;
+		case 's':
+			seed = strtoull(optarg, NULL, 0);
+			break;
+		case 'W':
+			sweepMin = parseSize(optarg, &end);
+			sweepMax = *end == ':' ? parseSize(end + 1, &end) :
+						 sweepMin;
+			break;
+		case 't':
+			threadCount = parseList(optarg, threadList,
+						BENCH_MAX_THREADS);
+			break;
+		case 'a':
+			sharedInputs = strcmp(optarg, "shared") == 0;
+			break;
+		case 'L':
+			pinCount = parseList(optarg, pinList, BENCH_MAX_THREADS);
+			break;
+		default:
+			usage();
+			return opt == 'h' ? 0 : -1;
+		}
+	}
+	char *filename = "rands.dat";
+	if (optind < argc) {
+		filename = argv[optind];
+	}
+	bench_host_t host;
+	bench_hostInfo(&host);
+	const uint64_t startSeed = seed;
+
+	//Priority 0 keeps the default scheduling
+	if (priority > 0) {
+		schedutil_sched_setFIFO(0, priority);
+	}
+	if (core >= 0) {
+		schedutil_pinToCore(0, &core, 1);
+	}
+
+	bench_pair_t *pairs = NULL;
+	int pairCount = 0;
+	for (int c = 0; c < codingCount; c++) {
+		if (!inList(codingList, codings[c]->name)) {
+			continue;
+		}
+		for (size_t o = 0; o < codings[c]->opCount; o++) {
+			//The calibration is always measured
+			if (!inList(opList, codings[c]->ops[o].name) &&
+			    strcmp(codings[c]->ops[o].name, BENCH_CALIBRATION)) {
+				continue;
+			}
+			for (int m = BENCH_THROUGHPUT; m <= BENCH_LATENCY; m++) {
+				if (!modes[m] || (m == BENCH_LATENCY &&
+						  !codings[c]->ops[o].latency)) {
+					continue;
+				}
+				pairs = realloc(pairs, sizeof(bench_pair_t) *
+							       (pairCount + 1));
+				pairs[pairCount].coding = codings[c];
+				pairs[pairCount].op = &codings[c]->ops[o];
+				pairs[pairCount].mode = m;
+				pairs[pairCount].counts = NULL;
+				pairs[pairCount].ns = NULL;
+				pairs[pairCount].runs = 0;
+				pairCount++;
+			}
+		}
+	}
+	if (pairCount == 0) {
+		printf("[Error] No operation selected\n");
+		usage();
+		return -1;
+	}
+	findReferences(pairs, pairCount);
+
+	randfile_t rands;
+	if (randfile_map(&rands, filename) != 0) {
+		return -2;
+	}
+	if (sweepMin == 0 && rands.count < test_count * 2) {
+		printf("[Error] %s contains only %lu values\n", filename,
+		       rands.count);
+		return -2;
+	}
+	bench_input_t input = { rands.vals32, rands.vals64,   rands.count,
+				test_count,   input_set,      rands.checksum,
+				cacheDir };
+	for (int p = 0; p < pairCount; p++) {
+		pairs[p].ns = malloc(sizeof(double) * num_tests);
+	}
+	if (sweepMin > 0 || threadCount > 0) {
+		char bufname[300];
+		int ret;
+		if (sweepMin > 0) {
+			sprintf(bufname, "sweep_%s%s.csv", prefix,
+				INPUT_SUFFIX[input_set]);
+			ret = runSweep(bufname, pairs, pairCount, input,
+				       sweepMin, sweepMax, num_tests, warmup,
+				       bootstrap, seed);
+		} else {
+			bench_config_t *configs = malloc(
+				sizeof(bench_config_t) * (threadCount + 1));
+			int configCount = makeConfigs(configs, threadList,
+						      threadCount, pinList,
+						      pinCount);
+			sprintf(bufname, "scale_%s%s.csv", prefix,
+				INPUT_SUFFIX[input_set]);
+			ret = runScaling(bufname, pairs, pairCount, &input,
+					 configs, configCount, sharedInputs,
+					 num_tests, warmup, seed);
+			free(configs);
+		}
+		for (int p = 0; p < pairCount; p++) {
+			free(pairs[p].ns);
+		}
+		free(pairs);
+		randfile_unmap(&rands);
+		return ret;
+	}
+
+	logger_config_t a = { LCLOCK_LINUX_REALTIME, 1,
+			      num_tests * pairCount * 2 };
+	logger_init(a);
+	const uint64_t counterConfig[BENCH_COUNTERS] = {
+		PERF_COUNT_HW_CPU_CYCLES,
+		PERF_COUNT_HW_INSTRUCTIONS,
+		PERF_COUNT_HW_BRANCH_MISSES,
+		BENCH_CACHE_MISS(PERF_COUNT_HW_CACHE_L1D),
+		BENCH_CACHE_MISS(PERF_COUNT_HW_CACHE_LL),
+		divConfig
+	};
+	perfgroup_t group;
+	perfgroup_open(&group, COUNTER_TYPE, counterConfig, BENCH_COUNTERS);
+	for (int p = 0; p < pairCount; p++) {
+		pairs[p].counts =
+			malloc(sizeof(uint64_t) * num_tests * BENCH_COUNTERS);
+		if (!pairs[p].counts || !pairs[p].ns) {
+			printf("[Error] Could not allocate the counters\n");
+			return -3;
+		}
+	}
+
+	//The pairs are sorted by coding, so each coding is encoded once
+	int ret = 0;
+	int *order = malloc(sizeof(int) * pairCount);
+	for (int first = 0; first < pairCount;) {
+		const bench_coding_t *coding = pairs[first].coding;
+		int last = first;
+		while (last < pairCount && pairs[last].coding == coding) {
+			last++;
+		}
+		printf("~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\n");
+		printf("Performance measurement of encoding: %s\n",
+		       coding->encoding);
+		printf("~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\n");
+		void *state = coding->setup(&input);
+		if (!state) {
+			printf("[Error] Could not allocate the inputs of %s\n",
+			       coding->name);
+			return -3;
+		}
+		for (int t = 0; t < warmup; t++) {
+			for (int p = first; p < last; p++) {
+				runPair(&pairs[p], state);
+			}
+		}
+		//The order of the operations changes each repetition
+		for (int p = first; p < last; p++) {
+			order[p - first] = p;
+		}
+		for (int t = 0; t < num_tests; t++) {
+			bench_shuffle(order, last - first, &seed);
+			for (int o = 0; o < last - first; o++) {
+				int p = order[o];
+				uint64_t start[BENCH_COUNTERS];
+				struct timespec ts_start, ts_end;
+				uint64_t *counts =
+					&pairs[p].counts[t * BENCH_COUNTERS];
+				perfgroup_read(&group, start);
+				logger_addLogEntry(2 * p, t, 0);
+				clock_gettime(CLOCK_MONOTONIC, &ts_start);
+				runPair(&pairs[p], state);
+				clock_gettime(CLOCK_MONOTONIC, &ts_end);
+				logger_addLogEntry(2 * p + 1, t, 0);
+				perfgroup_read(&group, counts);
+				pairs[p].ns[t] =
+					(ts_end.tv_sec - ts_start.tv_sec) * 1e9 +
+					(ts_end.tv_nsec - ts_start.tv_nsec);
+				for (int k = 0; k < BENCH_COUNTERS; k++) {
+					counts[k] -= start[k];
+				}
+				pairs[p].runs++;
+			}
+		}
+		if (coding->teardown(state) != 0) {
+			printf("[Warning] Check of the encoded inputs of %s failed\n",
+			       coding->name);
+			ret = 1;
+		}
+		first = last;
+	}
+
+	logger_tagDef_t *tagdef = makeLoggerDef(pairs, pairCount);
+	logger_tagPair_t *evalList = malloc(sizeof(logger_tagPair_t) * pairCount);
+	for (int p = 0; p < pairCount; p++) {
+		evalList[p] = (logger_tagPair_t){ 2 * p, 2 * p + 1 };
+	}
+
+	char bufname[300];
+	sprintf(bufname, "perf_%s%s.csv", prefix, INPUT_SUFFIX[input_set]);
+	logger_evaluate(evalList, pairCount, tagdef, pairCount * 2, bufname);
+	appendCounters(bufname, pairs, pairCount, tagdef, &group, num_tests);
+	perfgroup_close(&group);
+	bench_result_t *results = malloc(sizeof(bench_result_t) * pairCount);
+	computeStats(pairs, pairCount, test_count, bootstrap, seed, results);
+	sprintf(bufname, "stats_%s%s.csv", prefix, INPUT_SUFFIX[input_set]);
+	writeStats(bufname, pairs, pairCount, results);
+	bench_run_t run = { filename,  rands.checksum, input_set,
+			    num_tests, test_count,     modes,
+			    warmup,    bootstrap,      startSeed,
+			    core,      priority };
+	sprintf(bufname, "result_%s%s.json", prefix, INPUT_SUFFIX[input_set]);
+	writeRecord(bufname, &host, &run, pairs, pairCount, results);
+	free(results);
+
+	for (int p = 0; p < pairCount; p++) {
+		free(pairs[p].counts);
+		free(pairs[p].ns);
+	}
+	free(order);
+	free(evalList);
+	free(tagdef);
+	free(pairs);
+	randfile_unmap(&rands);
+	return ret;
+}
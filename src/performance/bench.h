@@ -0,0 +1,110 @@
+/**
+ * @copyright: (c) 2022, Institute for Control Engineering of Machine Tools and Manufacturing Units,
+ *             University of Stuttgart
+ *             All rights reserved. Licensed under the Apache License, Version 2.0 (the "License");
+ *             you may not use this file except in compliance with the License.
+ *             You may obtain a copy of the License at
+ *                  http://www.apache.org/licenses/LICENSE-2.0
+ *             Unless required by applicable law or agreed to in writing, software
+ *             distributed under the License is distributed on an "AS IS" BASIS,
+ *             WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *             See the License for the specific language governing permissions and
+ *             limitations under the License.
+ * @author: Marc Fischer <marc.fischer@isw.uni-stuttgart.de>
+ * @description: Registry of the benchmark driver. bench_coding.c is compiled once per coding and registers
+ *               the measured operations of the coding in a function table.
+ */
+#ifndef BENCH_H_
+#define BENCH_H_
+#ifdef __cplusplus
+extern "C" {
+#endif //__cplusplus
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define BENCH_STR_(a) #a
+#define BENCH_STR(a) BENCH_STR_(a)
+
+// Input sets: the values of the file, values for which add/sub/mul do not overflow and values for which they
+// always overflow. The profiles after them are small values, all pairs of the edge values of testList_int32,
+// pairs for which add and mul always overflow, pairs with alternating opposite signs and control signals.
+enum INPUT_SET {
+	INPUT_FILE,
+	INPUT_NOOV,
+	INPUT_OV,
+	INPUT_SMALL,
+	INPUT_EDGE,
+	INPUT_OVPAIR,
+	INPUT_SIGN,
+	INPUT_CONTROL,
+	INPUT_SETS
+};
+
+// Measurement modes. Throughput applies the operation to independent inputs, latency makes the load of the
+// first operand of the next operation depend on each result. The operands stay the inputs, as a chain of the
+// results would soon reach a constant (e.g. 0 for mul, div, and and shl).
+enum BENCH_MODE { BENCH_THROUGHPUT, BENCH_LATENCY };
+
+// Optimization barriers for the AC_INLINE operations. BENCH_SINK uses a result, so the loop can't be removed.
+// BENCH_OPAQUE also hides the value, so a dependent chain can't be folded, reassociated or vectorized.
+#define BENCH_SINK(x) __asm__ volatile("" : : "r"(x))
+#define BENCH_OPAQUE(x) __asm__ volatile("" : "+r"(x))
+// Sets z to 0 with a dependency on its value. An and with 0 is no zeroing idiom of the CPU, unlike xor.
+#if defined(__x86_64__)
+#define BENCH_DEPZERO(z) __asm__ volatile("and $0, %0" : "+r"(z))
+#elif defined(__aarch64__)
+#define BENCH_DEPZERO(z) __asm__ volatile("and %0, %0, xzr" : "+r"(z))
+#else
+//Without the dependency, the latency mode measures the throughput
+#define BENCH_DEPZERO(z)                                                       \
+	do {                                                                   \
+		(z) = 0;                                                       \
+		BENCH_OPAQUE(z);                                               \
+	} while (0)
+#endif
+
+// Operation of each coding that only loads the operands, its time is subtracted from the other operations
+#define BENCH_CALIBRATION "empty"
+
+// One measured operation, each function applies the operation to all inputs of the state returned by setup.
+// latency is NULL for batch operations, they are only measured in the throughput mode.
+typedef struct {
+	const char *name;
+	void (*throughput)(void *state);
+	void (*latency)(void *state);
+} bench_op_t;
+
+// Inputs of a coding. The 32 bit codings use vals32, the 64 bit codings vals64, [0..count-1] are x and
+// [count..2*count-1] are y. If 2*count is larger than the number of samples, the samples repeat.
+typedef struct {
+	const uint32_t *vals32;
+	const uint64_t *vals64;
+	size_t samples; //Samples per width
+	size_t count;
+	int inputSet;
+	uint64_t checksum; //Of the input file, part of the key of the cached encoded inputs
+	const char *cacheDir; //Directory of the cached encoded inputs, NULL to always encode
+} bench_input_t;
+
+typedef struct {
+	const char *name; //Name on the command line, e.g. an32
+	const char *encoding; //ENCODING_NAME of the coding
+	int width; //Width of the native values, the reference of the slowdown is the none coding of the width
+	size_t encSize; //Size of a code word
+	// Encodes the inputs or loads them from the cache. Returns the state of the inputs, NULL on failure.
+	void *(*setup)(const bench_input_t *input);
+	// Frees the state. Returns 0 if the checks of the encoded inputs passed.
+	int (*teardown)(void *state);
+	const bench_op_t *ops;
+	size_t opCount;
+} bench_coding_t;
+
+// Called by the constructor of each coding
+void bench_register(const bench_coding_t *coding);
+
+#ifdef __cplusplus
+}
+#endif //__cplusplus
+
+#endif //BENCH_H_
@@ -0,0 +1,519 @@
+/**
+ * @copyright: (c) 2022, Institute for Control Engineering of Machine Tools and Manufacturing Units,
+ *             University of Stuttgart
+ *             All rights reserved. Licensed under the Apache License, Version 2.0 (the "License");
+ *             you may not use this file except in compliance with the License.
+ *             You may obtain a copy of the License at
+ *                  http://www.apache.org/licenses/LICENSE-2.0
+ *             Unless required by applicable law or agreed to in writing, software
+ *             distributed under the License is distributed on an "AS IS" BASIS,
+ *             WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *             See the License for the specific language governing permissions and
+ *             limitations under the License.
+ * @author: Marc Fischer <marc.fischer@isw.uni-stuttgart.de>
+ * @description: Measured operations of one coding. The coding is selected by the definitions of
+ *               coding_defines.h, BENCH_NAME gives the name on the command line of the driver.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "bench.h"
+#include "helpers.h"
+#include "coding_defines.h"
+
+#ifndef BENCH_NAME
+#error "BENCH_NAME must be defined"
+#endif
+
+// Inputs of the operations. The scaling mode sets up one state per thread for private inputs.
+typedef struct {
+	size_t count;
+	ENC_TYPE *listX, *listY, *listR;
+	ENC_TYPE_U *listX_U, *listY_U, *listR_U;
+#ifdef SOA_TYPE
+	// Same values as listX/listY, values and checks in separate arrays
+	SOA_TYPE soaX, soaY, soaR;
+	SOA_TYPE_U soaX_U, soaY_U, soaR_U;
+	TEST_TYPE *refX;
+	int soa_ok;
+#endif
+} bench_state_t;
+
+// Sample i of the inputs with the width of the coding
+static uint64_t sample(const bench_input_t *input, size_t i)
+{
+#if WIDTH == 64
+	return input->vals64[i % input->samples];
+#else
+	return input->vals32[i % input->samples];
+#endif
+}
+
+static TEST_TYPE makeInput(uint64_t val, int set)
+{
+	if (set == INPUT_NOOV) {
+		//|x| < 2^15, odd to avoid a division by zero
+		return (TEST_TYPE)(((int16_t)val >> 1) | 1);
+	}
+	if (set == INPUT_OV) {
+		//2^(WIDTH-2) <= |x| < 2^(WIDTH-1), random sign
+		TEST_TYPE_U u = (TEST_TYPE_U)val | ((TEST_TYPE_U)1 << (WIDTH - 2));
+		u &= ~((TEST_TYPE_U)1 << (WIDTH - 1));
+		return (val & 1) ? -(TEST_TYPE)u : (TEST_TYPE)u;
+	}
+	if (set == INPUT_SMALL) {
+		//|x| < 2^7, odd
+		return (TEST_TYPE)((int8_t)val | 1);
+	}
+	return (TEST_TYPE)val;
+}
+static TEST_TYPE_U makeInput_U(uint64_t val, int set)
+{
+	if (set == INPUT_NOOV) {
+		return (TEST_TYPE_U)(((uint16_t)val >> 1) | 1);
+	}
+	if (set == INPUT_OV) {
+		//x >= 2^(WIDTH-1)
+		return (TEST_TYPE_U)val | ((TEST_TYPE_U)1 << (WIDTH - 1));
+	}
+	if (set == INPUT_SMALL) {
+		return (TEST_TYPE_U)((uint8_t)val | 1);
+	}
+	return (TEST_TYPE_U)val;
+}
+
+#define TEST_MAX ((TEST_TYPE)(((TEST_TYPE_U)1 << (WIDTH - 1)) - 1))
+#define TEST_MIN (-TEST_MAX - 1)
+// The values of testList_int32 with the width of the coding
+static const TEST_TYPE edgeList[TESTLISTSIZE_INT] = { 0,	1,
+						      -1,	TEST_MAX,
+						      TEST_MIN, TEST_MIN + 1 };
+
+// Inputs i of the profiles that depend on both operands. vx and vy are the samples of the inputs.
+static void makePair(uint64_t vx, uint64_t vy, size_t i, int set, TEST_TYPE *x,
+		     TEST_TYPE *y)
+{
+	switch (set) {
+	case INPUT_EDGE:
+		//All combinations, y is not 0. MIN / ±1 traps for the complement codings, which divide the negated
+		//values, it is replaced by MIN + 1 / ±1.
+		*x = edgeList[i % TESTLISTSIZE_INT];
+		*y = edgeList[1 + (i / TESTLISTSIZE_INT) % (TESTLISTSIZE_INT - 1)];
+		if (*x == TEST_MIN && (*y == 1 || *y == -1)) {
+			*x = TEST_MIN + 1;
+		}
+		break;
+	case INPUT_OVPAIR:
+		//Same sign and 2^(WIDTH-2) <= |x|, |y|, so add and mul overflow for every pair
+		*x = makeInput(vx, INPUT_OV);
+		*y = makeInput(vy, INPUT_OV);
+		if ((*x < 0) != (*y < 0)) {
+			*y = -*y;
+		}
+		break;
+	case INPUT_SIGN:
+		//|x|, |y| < 2^15 with opposite signs, the sign of x alternates
+		*x = makeInput(vx, INPUT_NOOV);
+		*y = makeInput(vy, INPUT_NOOV);
+		*x = (*x < 0) == (i & 1) ? *x : -*x;
+		*y = (*x < 0) != (*y < 0) ? *y : -*y;
+		break;
+	case INPUT_CONTROL:
+		//12 bit sensor value on a slow ramp with noise, multiplied with or offset by a small gain |y| < 2^6
+		*x = (TEST_TYPE)((int64_t)((i >> 4) & 0xfff) - 2048 +
+				 ((int8_t)vx >> 3));
+		*y = (TEST_TYPE)(((int8_t)vy >> 1) | 1);
+		break;
+	default:
+		*x = makeInput(vx, set);
+		*y = makeInput(vy, set);
+	}
+}
+static void makePair_U(uint64_t vx, uint64_t vy, size_t i, int set,
+		       TEST_TYPE_U *x, TEST_TYPE_U *y)
+{
+	switch (set) {
+	case INPUT_EDGE:
+	case INPUT_SIGN: {
+		//The bit patterns of the signed inputs
+		TEST_TYPE sx, sy;
+		makePair(vx, vy, i, set, &sx, &sy);
+		*x = (TEST_TYPE_U)sx;
+		*y = (TEST_TYPE_U)sy;
+		break;
+	}
+	case INPUT_OVPAIR:
+		*x = makeInput_U(vx, INPUT_OV);
+		*y = makeInput_U(vy, INPUT_OV);
+		break;
+	case INPUT_CONTROL:
+		*x = (TEST_TYPE_U)(((i >> 4) & 0xfff) + (vx & 0xf));
+		*y = (TEST_TYPE_U)((vy & 0x3f) | 1);
+		break;
+	default:
+		*x = makeInput_U(vx, set);
+		*y = makeInput_U(vy, set);
+	}
+}
+
+static int teardown(void *state)
+{
+	bench_state_t *st = state;
+	int ret = 0;
+	free(st->listX);
+	free(st->listY);
+	free(st->listR);
+	free(st->listX_U);
+	free(st->listY_U);
+	free(st->listR_U);
+	st->listX = st->listY = st->listR = NULL;
+	st->listX_U = st->listY_U = st->listR_U = NULL;
+#ifdef SOA_TYPE
+	ENCODEDFUNCTION(soa_free)(&st->soaX);
+	ENCODEDFUNCTION(soa_free)(&st->soaY);
+	ENCODEDFUNCTION(soa_free)(&st->soaR);
+	ENCODEDFUNCTION_U(soa_free)(&st->soaX_U);
+	ENCODEDFUNCTION_U(soa_free)(&st->soaY_U);
+	ENCODEDFUNCTION_U(soa_free)(&st->soaR_U);
+	free(st->refX);
+	st->refX = NULL;
+	ret = !st->soa_ok;
+#endif
+	free(st);
+	return ret;
+}
+
+// Header of the cached encoded inputs, followed by listX, listY, listX_U and listY_U
+#define BENCH_CACHE_VERSION 1
+typedef struct {
+	char magic[8];
+	uint32_t version;
+	uint32_t encSize; //sizeof(ENC_TYPE) << 16 | sizeof(ENC_TYPE_U)
+	uint64_t count;
+	uint64_t inputSet;
+	uint64_t checksum;
+} bench_cache_t;
+
+static void cacheHeader(bench_cache_t *header, const bench_input_t *input)
+{
+	memset(header, 0, sizeof(*header));
+	memcpy(header->magic, "ACENC", sizeof("ACENC"));
+	header->version = BENCH_CACHE_VERSION;
+	header->encSize = sizeof(ENC_TYPE) << 16 | sizeof(ENC_TYPE_U);
+	header->count = input->count;
+	header->inputSet = input->inputSet;
+	header->checksum = input->checksum;
+}
+
+static void cacheName(char *name, size_t len, const bench_input_t *input)
+{
+	snprintf(name, len, "%s/%s_%d.enc", input->cacheDir,
+		 BENCH_STR(BENCH_NAME), input->inputSet);
+}
+
+// Returns 0 if the encoded inputs were loaded from the cache
+static int cacheLoad(bench_state_t *st, const bench_input_t *input)
+{
+	char name[512];
+	bench_cache_t header, expected;
+	size_t n = st->count;
+	cacheName(name, sizeof(name), input);
+	cacheHeader(&expected, input);
+	FILE *pFile = fopen(name, "rb");
+	if (!pFile) {
+		return -1;
+	}
+	int ret = -1;
+	if (fread(&header, sizeof(header), 1, pFile) == 1 &&
+	    memcmp(&header, &expected, sizeof(header)) == 0 &&
+	    fread(st->listX, sizeof(ENC_TYPE), n, pFile) == n &&
+	    fread(st->listY, sizeof(ENC_TYPE), n, pFile) == n &&
+	    fread(st->listX_U, sizeof(ENC_TYPE_U), n, pFile) == n &&
+	    fread(st->listY_U, sizeof(ENC_TYPE_U), n, pFile) == n) {
+		ret = 0;
+	}
+	fclose(pFile);
+	return ret;
+}
+
+static void cacheStore(const bench_state_t *st, const bench_input_t *input)
+{
+	char name[512];
+	bench_cache_t header;
+	cacheName(name, sizeof(name), input);
+	cacheHeader(&header, input);
+	FILE *pFile = fopen(name, "wb");
+	if (!pFile) {
+		printf("[Warning] Could not write the cache %s\n", name);
+		return;
+	}
+	fwrite(&header, sizeof(header), 1, pFile);
+	fwrite(st->listX, sizeof(ENC_TYPE), st->count, pFile);
+	fwrite(st->listY, sizeof(ENC_TYPE), st->count, pFile);
+	fwrite(st->listX_U, sizeof(ENC_TYPE_U), st->count, pFile);
+	fwrite(st->listY_U, sizeof(ENC_TYPE_U), st->count, pFile);
+	fclose(pFile);
+}
+
+static void *setup(const bench_input_t *input)
+{
+	int set = input->inputSet;
+	bench_state_t *st = calloc(1, sizeof(bench_state_t));
+	if (!st) {
+		return NULL;
+	}
+	st->count = input->count;
+	st->listX = malloc(sizeof(ENC_TYPE) * st->count);
+	st->listY = malloc(sizeof(ENC_TYPE) * st->count);
+	st->listR = malloc(sizeof(ENC_TYPE) * st->count);
+	st->listX_U = malloc(sizeof(ENC_TYPE_U) * st->count);
+	st->listY_U = malloc(sizeof(ENC_TYPE_U) * st->count);
+	st->listR_U = malloc(sizeof(ENC_TYPE_U) * st->count);
+	if (!st->listX || !st->listY || !st->listR || !st->listX_U ||
+	    !st->listY_U || !st->listR_U) {
+		teardown(st);
+		return NULL;
+	}
+	if (input->cacheDir == NULL || cacheLoad(st, input) != 0) {
+		for (size_t i = 0; i < st->count; i++) {
+			uint64_t vx = sample(input, i);
+			uint64_t vy = sample(input, st->count + i);
+			TEST_TYPE x, y;
+			TEST_TYPE_U x_U, y_U;
+			makePair(vx, vy, i, set, &x, &y);
+			makePair_U(vx, vy, i, set, &x_U, &y_U);
+			st->listX[i] = ENCODEDFUNCTION(encode)(x);
+			st->listX_U[i] = ENCODEDFUNCTION_U(encode)(x_U);
+			st->listY[i] = ENCODEDFUNCTION(encode)(y);
+			st->listY_U[i] = ENCODEDFUNCTION_U(encode)(y_U);
+		}
+		if (input->cacheDir != NULL) {
+			cacheStore(st, input);
+		}
+	}
+#ifdef SOA_TYPE
+	st->soaX = ENCODEDFUNCTION(soa_alloc)(st->count);
+	st->soaY = ENCODEDFUNCTION(soa_alloc)(st->count);
+	st->soaR = ENCODEDFUNCTION(soa_alloc)(st->count);
+	st->soaX_U = ENCODEDFUNCTION_U(soa_alloc)(st->count);
+	st->soaY_U = ENCODEDFUNCTION_U(soa_alloc)(st->count);
+	st->soaR_U = ENCODEDFUNCTION_U(soa_alloc)(st->count);
+	st->refX = malloc(sizeof(TEST_TYPE) * st->count);
+	if (st->soaX.n != st->count || st->soaY.n != st->count ||
+	    st->soaR.n != st->count || st->soaX_U.n != st->count ||
+	    st->soaY_U.n != st->count || st->soaR_U.n != st->count ||
+	    !st->refX) {
+		teardown(st);
+		return NULL;
+	}
+	for (size_t i = 0; i < st->count; i++) {
+		ENCODEDFUNCTION(soa_set)(&st->soaX, i, st->listX[i]);
+		ENCODEDFUNCTION(soa_set)(&st->soaY, i, st->listY[i]);
+		ENCODEDFUNCTION_U(soa_set)(&st->soaX_U, i, st->listX_U[i]);
+		ENCODEDFUNCTION_U(soa_set)(&st->soaY_U, i, st->listY_U[i]);
+	}
+	ENCODEDFUNCTION_N(decode)(st->listX, st->refX, st->count);
+	st->soa_ok = 1;
+#endif
+	return st;
+}
+
+// Zero of the low byte of r, the next operand is loaded with it as offset
+#define BENCH_DEP(dep, r)                                                      \
+	do {                                                                   \
+		unsigned char low;                                             \
+		BENCH_OPAQUE(r);                                               \
+		memcpy(&low, &(r), 1);                                         \
+		(dep) = low;                                                   \
+		BENCH_DEPZERO(dep);                                            \
+	} while (0)
+
+// Scalar operation in a loop over all inputs, independent and as dependent chain
+#define BENCH_OP(name, T, fun, x, y)                                           \
+	static void bench_##name(void *state)                                  \
+	{                                                                      \
+		bench_state_t *st = state;                                     \
+		T r_enc;                                                       \
+		for (size_t i = 0; i < st->count; i++) {                       \
+			r_enc = fun(st->x[i], st->y[i]);                       \
+			BENCH_SINK(r_enc);                                     \
+		}                                                              \
+	}                                                                      \
+	static void bench_##name##_lat(void *state)                            \
+	{                                                                      \
+		bench_state_t *st = state;                                     \
+		T r_enc;                                                       \
+		size_t dep = 0;                                                \
+		for (size_t i = 0; i < st->count; i++) {                       \
+			r_enc = fun(st->x[i + dep], st->y[i]);                 \
+			BENCH_DEP(dep, r_enc);                                 \
+		}                                                              \
+	}
+#define BENCH_OP1(name, T, fun, x)                                             \
+	static void bench_##name(void *state)                                  \
+	{                                                                      \
+		bench_state_t *st = state;                                     \
+		T r_enc;                                                       \
+		for (size_t i = 0; i < st->count; i++) {                       \
+			r_enc = fun(st->x[i]);                                 \
+			BENCH_SINK(r_enc);                                     \
+		}                                                              \
+	}                                                                      \
+	static void bench_##name##_lat(void *state)                            \
+	{                                                                      \
+		bench_state_t *st = state;                                     \
+		T r_enc;                                                       \
+		size_t dep = 0;                                                \
+		for (size_t i = 0; i < st->count; i++) {                       \
+			r_enc = fun(st->x[i + dep]);                           \
+			BENCH_DEP(dep, r_enc);                                 \
+		}                                                              \
+	}
+// Batch operation over all inputs
+#define BENCH_OP_N(name, fun, x, y, r)                                         \
+	static void bench_##name(void *state)                                  \
+	{                                                                      \
+		bench_state_t *st = state;                                     \
+		fun(st->x, st->y, st->r, st->count);                           \
+	}
+#define BENCH_OP1_N(name, fun, x, r)                                           \
+	static void bench_##name(void *state)                                  \
+	{                                                                      \
+		bench_state_t *st = state;                                     \
+		fun(st->x, st->r, st->count);                                  \
+	}
+
+// Signed, unsigned, batch signed and batch unsigned version of a binary operation
+#define BENCH_OPS(op)                                                          \
+	BENCH_OP(op, ENC_TYPE, ENCODEDFUNCTION(op), listX, listY)              \
+	BENCH_OP(op##_u, ENC_TYPE_U, ENCODEDFUNCTION_U(op), listX_U, listY_U)  \
+	BENCH_OP_N(op##_n, ENCODEDFUNCTION_N(op), listX, listY, listR)         \
+	BENCH_OP_N(op##_u_n, ENCODEDFUNCTION_U_N(op), listX_U, listY_U,        \
+		   listR_U)
+
+// Calibration: the loop of an operation that only loads its operands
+AC_INLINE ENC_TYPE bench_nop(ENC_TYPE x, ENC_TYPE y)
+{
+	BENCH_SINK(y);
+	return x;
+}
+BENCH_OP(empty, ENC_TYPE, bench_nop, listX, listY)
+
+BENCH_OPS(add)
+BENCH_OPS(sub)
+BENCH_OPS(mul)
+BENCH_OPS(div)
+BENCH_OPS(mod)
+BENCH_OPS(eq)
+BENCH_OPS(neq)
+BENCH_OPS(leq)
+BENCH_OPS(geq)
+BENCH_OPS(less)
+BENCH_OPS(grt)
+BENCH_OPS(shl)
+BENCH_OPS(land)
+BENCH_OPS(lor)
+BENCH_OPS(and)
+BENCH_OPS(or)
+BENCH_OPS(xor)
+BENCH_OP(shr_u, ENC_TYPE_U, ENCODEDFUNCTION_U(shr), listX_U, listY_U)
+BENCH_OP_N(shr_u_n, ENCODEDFUNCTION_U_N(shr), listX_U, listY_U, listR_U)
+BENCH_OP1(neg, ENC_TYPE, ENCODEDFUNCTION(neg), listX)
+BENCH_OP1(neg_u, ENC_TYPE_U, ENCODEDFUNCTION_U(neg), listX_U)
+BENCH_OP1_N(neg_n, ENCODEDFUNCTION_N(neg), listX, listR)
+BENCH_OP1_N(neg_u_n, ENCODEDFUNCTION_U_N(neg), listX_U, listR_U)
+
+#ifdef SOA_TYPE
+#define BENCH_OP_SOA(name, fun, x, y, r)                                       \
+	static void bench_##name(void *state)                                  \
+	{                                                                      \
+		bench_state_t *st = state;                                     \
+		fun(&st->x, &st->y, &st->r);                                   \
+	}
+BENCH_OP_SOA(add_soa, ENCODEDFUNCTION_SOA(add), soaX, soaY, soaR)
+BENCH_OP_SOA(sub_soa, ENCODEDFUNCTION_SOA(sub), soaX, soaY, soaR)
+BENCH_OP_SOA(mul_soa, ENCODEDFUNCTION_SOA(mul), soaX, soaY, soaR)
+BENCH_OP_SOA(add_u_soa, ENCODEDFUNCTION_U_SOA(add), soaX_U, soaY_U, soaR_U)
+BENCH_OP_SOA(sub_u_soa, ENCODEDFUNCTION_U_SOA(sub), soaX_U, soaY_U, soaR_U)
+BENCH_OP_SOA(mul_u_soa, ENCODEDFUNCTION_U_SOA(mul), soaX_U, soaY_U, soaR_U)
+static void bench_check_n(void *state)
+{
+	bench_state_t *st = state;
+	st->soa_ok &= ENCODEDFUNCTION_N(check)(st->refX, st->listX, st->count);
+}
+static void bench_check_soa(void *state)
+{
+	bench_state_t *st = state;
+	st->soa_ok &= ENCODEDFUNCTION_SOA(check)(&st->soaX);
+}
+#endif
+
+// Scalar operations are measured in both modes, the batch operations store their results and only have a
+// throughput. In the latency mode, div, mod and the shifts converge to small values.
+#define BENCH_ENTRY(name) { #name, bench_##name, bench_##name##_lat }
+#define BENCH_ENTRY_N(name) { #name, bench_##name, NULL }
+// Same order as the evaluation of the former per coding binaries, signed and unsigned next to each other
+static const bench_op_t ops[] = {
+	BENCH_ENTRY(empty),
+	BENCH_ENTRY(add), BENCH_ENTRY(add_u),
+	BENCH_ENTRY(sub), BENCH_ENTRY(sub_u),
+	BENCH_ENTRY(mul), BENCH_ENTRY(mul_u),
+	BENCH_ENTRY(div), BENCH_ENTRY(div_u),
+	BENCH_ENTRY(mod), BENCH_ENTRY(mod_u),
+	BENCH_ENTRY(eq), BENCH_ENTRY(eq_u),
+	BENCH_ENTRY(neq), BENCH_ENTRY(neq_u),
+	BENCH_ENTRY(leq), BENCH_ENTRY(leq_u),
+	BENCH_ENTRY(geq), BENCH_ENTRY(geq_u),
+	BENCH_ENTRY(less), BENCH_ENTRY(less_u),
+	BENCH_ENTRY(grt), BENCH_ENTRY(grt_u),
+	BENCH_ENTRY(shr_u),
+	BENCH_ENTRY(shl), BENCH_ENTRY(shl_u),
+	BENCH_ENTRY(land), BENCH_ENTRY(land_u),
+	BENCH_ENTRY(lor), BENCH_ENTRY(lor_u),
+	BENCH_ENTRY(and), BENCH_ENTRY(and_u),
+	BENCH_ENTRY(or), BENCH_ENTRY(or_u),
+	BENCH_ENTRY(xor), BENCH_ENTRY(xor_u),
+	BENCH_ENTRY(neg), BENCH_ENTRY(neg_u),
+	BENCH_ENTRY_N(add_n), BENCH_ENTRY_N(add_u_n),
+	BENCH_ENTRY_N(sub_n), BENCH_ENTRY_N(sub_u_n),
+	BENCH_ENTRY_N(mul_n), BENCH_ENTRY_N(mul_u_n),
+	BENCH_ENTRY_N(div_n), BENCH_ENTRY_N(div_u_n),
+	BENCH_ENTRY_N(mod_n), BENCH_ENTRY_N(mod_u_n),
+	BENCH_ENTRY_N(eq_n), BENCH_ENTRY_N(eq_u_n),
+	BENCH_ENTRY_N(neq_n), BENCH_ENTRY_N(neq_u_n),
+	BENCH_ENTRY_N(leq_n), BENCH_ENTRY_N(leq_u_n),
+	BENCH_ENTRY_N(geq_n), BENCH_ENTRY_N(geq_u_n),
+	BENCH_ENTRY_N(less_n), BENCH_ENTRY_N(less_u_n),
+	BENCH_ENTRY_N(grt_n), BENCH_ENTRY_N(grt_u_n),
+	BENCH_ENTRY_N(shr_u_n),
+	BENCH_ENTRY_N(shl_n), BENCH_ENTRY_N(shl_u_n),
+	BENCH_ENTRY_N(land_n), BENCH_ENTRY_N(land_u_n),
+	BENCH_ENTRY_N(lor_n), BENCH_ENTRY_N(lor_u_n),
+	BENCH_ENTRY_N(and_n), BENCH_ENTRY_N(and_u_n),
+	BENCH_ENTRY_N(or_n), BENCH_ENTRY_N(or_u_n),
+	BENCH_ENTRY_N(xor_n), BENCH_ENTRY_N(xor_u_n),
+	BENCH_ENTRY_N(neg_n), BENCH_ENTRY_N(neg_u_n),
+#ifdef SOA_TYPE
+	BENCH_ENTRY_N(add_soa), BENCH_ENTRY_N(add_u_soa),
+	BENCH_ENTRY_N(sub_soa), BENCH_ENTRY_N(sub_u_soa),
+	BENCH_ENTRY_N(mul_soa), BENCH_ENTRY_N(mul_u_soa),
+	BENCH_ENTRY_N(check_n), BENCH_ENTRY_N(check_soa),
+#endif
+};
+
+static const bench_coding_t coding = { BENCH_STR(BENCH_NAME),
+				       ENCODING_NAME,
+				       WIDTH,
+				       sizeof(ENC_TYPE),
+				       setup,
+				       teardown,
+				       ops,
+				       sizeof(ops) / sizeof(ops[0]) };
+
+__attribute__((constructor)) static void bench_register_coding(void)
+{
+#ifdef AN64
+	init();
+#endif
+	bench_register(&coding);
+}
@@ -0,0 +1,161 @@
+/**
+ * @copyright: (c) 2022, Institute for Control Engineering of Machine Tools and Manufacturing Units,
+ *             University of Stuttgart
+ *             All rights reserved. Licensed under the Apache License, Version 2.0 (the "License");
+ *             you may not use this file except in compliance with the License.
+ *             You may obtain a copy of the License at
+ *                  http://www.apache.org/licenses/LICENSE-2.0
+ *             Unless required by applicable law or agreed to in writing, software
+ *             distributed under the License is distributed on an "AS IS" BASIS,
+ *             WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *             See the License for the specific language governing permissions and
+ *             limitations under the License.
+ * @author: Marc Fischer <marc.fischer@isw.uni-stuttgart.de>
+ * @description: Host and build metadata of the result record
+ */
+#include "bench_record.h"
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/utsname.h>
+
+// Set by CMake at configure time
+#ifndef BENCH_COMMIT
+#define BENCH_COMMIT "unknown"
+#endif
+#ifndef BENCH_CFLAGS
+#define BENCH_CFLAGS ""
+#endif
+#ifndef BENCH_BUILD_TYPE
+#define BENCH_BUILD_TYPE ""
+#endif
+
+// First line of a file without the newline, empty if it cannot be read
+static void readLine(const char *filename, char *buf, size_t size)
+{
+	buf[0] = 0;
+	FILE *pFile = fopen(filename, "r");
+	if (!pFile) {
+		return;
+	}
+	if (fgets(buf, size, pFile)) {
+		buf[strcspn(buf, "\n")] = 0;
+	}
+	fclose(pFile);
+}
+
+// Value of the first line of /proc/cpuinfo with the key, e.g. model name
+static void cpuinfo(const char *key, char *buf, size_t size)
+{
+	char line[512];
+	buf[0] = 0;
+	FILE *pFile = fopen("/proc/cpuinfo", "r");
+	if (!pFile) {
+		return;
+	}
+	size_t len = strlen(key);
+	while (fgets(line, sizeof(line), pFile)) {
+		if (strncmp(line, key, len) == 0) {
+			char *value = strchr(line, ':');
+			if (value) {
+				value += strspn(value, ": \t");
+				value[strcspn(value, "\n")] = 0;
+				snprintf(buf, size, "%s", value);
+			}
+			break;
+		}
+	}
+	fclose(pFile);
+}
+
+void bench_hostInfo(bench_host_t *host)
+{
+	struct utsname name;
+	memset(host, 0, sizeof(*host));
+	if (uname(&name) == 0) {
+		snprintf(host->hostname, sizeof(host->hostname), "%s",
+			 name.nodename);
+		snprintf(host->os, sizeof(host->os), "%s", name.sysname);
+		snprintf(host->kernel, sizeof(host->kernel), "%s %s",
+			 name.release, name.version);
+		snprintf(host->machine, sizeof(host->machine), "%s",
+			 name.machine);
+	}
+	cpuinfo("model name", host->cpu, sizeof(host->cpu));
+	if (host->cpu[0] == 0) {
+		//Arm has no model name
+		cpuinfo("CPU part", host->cpu, sizeof(host->cpu));
+	}
+	host->cpus = sysconf(_SC_NPROCESSORS_ONLN);
+	readLine("/sys/devices/system/cpu/cpu0/cpufreq/scaling_governor",
+		 host->governor, sizeof(host->governor));
+#if defined(__clang__)
+	snprintf(host->compiler, sizeof(host->compiler), "clang %s",
+		 __clang_version__);
+#elif defined(__GNUC__)
+	snprintf(host->compiler, sizeof(host->compiler), "gcc %s", __VERSION__);
+#endif
+	snprintf(host->flags, sizeof(host->flags), "%s", BENCH_CFLAGS);
+	snprintf(host->buildType, sizeof(host->buildType), "%s",
+		 BENCH_BUILD_TYPE);
+	snprintf(host->commit, sizeof(host->commit), "%s", BENCH_COMMIT);
+	time_t now = time(NULL);
+	strftime(host->date, sizeof(host->date), "%Y-%m-%dT%H:%M:%SZ",
+		 gmtime(&now));
+}
+
+void bench_jsonString(FILE *pFile, const char *str)
+{
+	fputc('"', pFile);
+	for (; *str; str++) {
+		unsigned char c = *str;
+		if (c == '"' || c == '\\') {
+			fprintf(pFile, "\\%c", c);
+		} else if (c < 0x20) {
+			fprintf(pFile, "\\u%04x", c);
+		} else {
+			fputc(c, pFile);
+		}
+	}
+	fputc('"', pFile);
+}
+
+void bench_jsonNumber(FILE *pFile, double value)
+{
+	if (isfinite(value)) {
+		fprintf(pFile, "%.17g", value);
+	} else {
+		fprintf(pFile, "null");
+	}
+}
+
+// "key": "value"
+static void jsonMember(FILE *pFile, const char *key, const char *value,
+		       const char *sep)
+{
+	fprintf(pFile, "    ");
+	bench_jsonString(pFile, key);
+	fprintf(pFile, ": ");
+	bench_jsonString(pFile, value);
+	fprintf(pFile, "%s\n", sep);
+}
+
+void bench_jsonHost(FILE *pFile, const bench_host_t *host)
+{
+	fprintf(pFile, "  \"host\": {\n");
+	jsonMember(pFile, "hostname", host->hostname, ",");
+	jsonMember(pFile, "os", host->os, ",");
+	jsonMember(pFile, "kernel", host->kernel, ",");
+	jsonMember(pFile, "machine", host->machine, ",");
+	jsonMember(pFile, "cpu", host->cpu, ",");
+	fprintf(pFile, "    \"cpus\": %ld,\n", host->cpus);
+	jsonMember(pFile, "governor", host->governor, "");
+	fprintf(pFile, "  },\n");
+	fprintf(pFile, "  \"build\": {\n");
+	jsonMember(pFile, "compiler", host->compiler, ",");
+	jsonMember(pFile, "flags", host->flags, ",");
+	jsonMember(pFile, "build_type", host->buildType, ",");
+	jsonMember(pFile, "commit", host->commit, "");
+	fprintf(pFile, "  },\n");
+}
@@ -0,0 +1,61 @@
+/**
+ * @copyright: (c) 2022, Institute for Control Engineering of Machine Tools and Manufacturing Units,
+ *             University of Stuttgart
+ *             All rights reserved. Licensed under the Apache License, Version 2.0 (the "License");
+ *             you may not use this file except in compliance with the License.
+ *             You may obtain a copy of the License at
+ *                  http://www.apache.org/licenses/LICENSE-2.0
+ *             Unless required by applicable law or agreed to in writing, software
+ *             distributed under the License is distributed on an "AS IS" BASIS,
+ *             WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *             See the License for the specific language governing permissions and
+ *             limitations under the License.
+ * @author: Marc Fischer <marc.fischer@isw.uni-stuttgart.de>
+ * @description: Result record of a benchmark run: host and build metadata and JSON output helpers. The record
+ *               is a JSON object with the members format, version, host, build, run and results, see
+ *               bench.c for the run parameters and the results of each pair.
+ */
+#ifndef BENCH_RECORD_H_
+#define BENCH_RECORD_H_
+#ifdef __cplusplus
+extern "C" {
+#endif //__cplusplus
+
+#include <stdio.h>
+#include <sys/utsname.h>
+
+#define BENCH_RECORD_FORMAT "acbench"
+#define BENCH_RECORD_VERSION 1
+
+typedef struct {
+	//The uname fields are sized by struct utsname, so they hold every value
+	char hostname[sizeof(((struct utsname *)0)->nodename)];
+	char os[sizeof(((struct utsname *)0)->sysname)];
+	//uname release and version, separated by a space
+	char kernel[sizeof(((struct utsname *)0)->release) +
+		    sizeof(((struct utsname *)0)->version)];
+	char machine[sizeof(((struct utsname *)0)->machine)];
+	char cpu[256]; //Model name of /proc/cpuinfo
+	long cpus; //Online cores
+	char governor[64]; //cpufreq governor of core 0, empty if unknown
+	char compiler[256];
+	char flags[512];
+	char buildType[64];
+	char commit[64]; //git describe at configure time
+	char date[32]; //Start of the run, UTC ISO 8601
+} bench_host_t;
+
+// Fills the metadata of this host and build
+void bench_hostInfo(bench_host_t *host);
+// Writes str as JSON string with quotes
+void bench_jsonString(FILE *pFile, const char *str);
+// Writes a number, nan and inf as null
+void bench_jsonNumber(FILE *pFile, double value);
+// Writes the members host and build of the record, each followed by a comma
+void bench_jsonHost(FILE *pFile, const bench_host_t *host);
+
+#ifdef __cplusplus
+}
+#endif //__cplusplus
+
+#endif //BENCH_RECORD_H_
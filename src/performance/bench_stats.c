@@ -0,0 +1,111 @@
+/**
+ * @copyright: (c) 2022, Institute for Control Engineering of Machine Tools and Manufacturing Units,
+ *             University of Stuttgart
+ *             All rights reserved. Licensed under the Apache License, Version 2.0 (the "License");
+ *             you may not use this file except in compliance with the License.
+ *             You may obtain a copy of the License at
+ *                  http://www.apache.org/licenses/LICENSE-2.0
+ *             Unless required by applicable law or agreed to in writing, software
+ *             distributed under the License is distributed on an "AS IS" BASIS,
+ *             WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *             See the License for the specific language governing permissions and
+ *             limitations under the License.
+ * @author: Marc Fischer <marc.fischer@isw.uni-stuttgart.de>
+ * @description: Statistics of the benchmark driver: medians and percentile bootstrap of the runs
+ */
+#include "bench_stats.h"
+#include <stdlib.h>
+
+uint64_t bench_rand(uint64_t *state)
+{
+	uint64_t z = (*state += 0x9e3779b97f4a7c15ULL);
+	z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+	z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+	return z ^ (z >> 31);
+}
+
+void bench_shuffle(int *list, int n, uint64_t *state)
+{
+	for (int i = n - 1; i > 0; i--) {
+		int j = bench_rand(state) % (i + 1);
+		int tmp = list[i];
+		list[i] = list[j];
+		list[j] = tmp;
+	}
+}
+
+// k-th smallest value of vals[0..n-1] (quickselect), reorders vals
+static double selectKth(double *vals, int n, int k)
+{
+	int lo = 0, hi = n - 1;
+	while (lo < hi) {
+		double pivot = vals[(lo + hi) / 2];
+		int i = lo, j = hi;
+		while (i <= j) {
+			while (vals[i] < pivot) {
+				i++;
+			}
+			while (vals[j] > pivot) {
+				j--;
+			}
+			if (i <= j) {
+				double tmp = vals[i];
+				vals[i] = vals[j];
+				vals[j] = tmp;
+				i++;
+				j--;
+			}
+		}
+		if (k <= j) {
+			hi = j;
+		} else if (k >= i) {
+			lo = i;
+		} else {
+			break;
+		}
+	}
+	return vals[k];
+}
+
+double bench_median(double *vals, int n)
+{
+	if (n == 0) {
+		return 0;
+	}
+	double upper = selectKth(vals, n, n / 2);
+	if (n % 2) {
+		return upper;
+	}
+	//The lower half is left of n/2 after the selection
+	double lower = vals[0];
+	for (int i = 1; i < n / 2; i++) {
+		lower = vals[i] > lower ? vals[i] : lower;
+	}
+	return (lower + upper) / 2;
+}
+
+void bench_bootstrapMedian(const double *samples, int n, double *medians,
+			   int count, uint64_t *state)
+{
+	double *resample = malloc(sizeof(double) * n);
+	for (int b = 0; b < count; b++) {
+		for (int i = 0; i < n; i++) {
+			resample[i] = samples[bench_rand(state) % n];
+		}
+		medians[b] = bench_median(resample, n);
+	}
+	free(resample);
+}
+
+void bench_interval(double *vals, int n, double level, double *low,
+		    double *high)
+{
+	if (n == 0) {
+		*low = *high = 0;
+		return;
+	}
+	int kLow = (int)((1 - level) / 2 * (n - 1));
+	int kHigh = (n - 1) - kLow;
+	*low = selectKth(vals, n, kLow);
+	*high = selectKth(vals, n, kHigh);
+}
@@ -0,0 +1,41 @@
+/**
+ * @copyright: (c) 2022, Institute for Control Engineering of Machine Tools and Manufacturing Units,
+ *             University of Stuttgart
+ *             All rights reserved. Licensed under the Apache License, Version 2.0 (the "License");
+ *             you may not use this file except in compliance with the License.
+ *             You may obtain a copy of the License at
+ *                  http://www.apache.org/licenses/LICENSE-2.0
+ *             Unless required by applicable law or agreed to in writing, software
+ *             distributed under the License is distributed on an "AS IS" BASIS,
+ *             WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *             See the License for the specific language governing permissions and
+ *             limitations under the License.
+ * @author: Marc Fischer <marc.fischer@isw.uni-stuttgart.de>
+ * @description: Statistics of the benchmark driver: medians and percentile bootstrap of the runs
+ */
+#ifndef BENCH_STATS_H_
+#define BENCH_STATS_H_
+#ifdef __cplusplus
+extern "C" {
+#endif //__cplusplus
+
+#include <stdint.h>
+
+// Uniform random number of the seeded state (splitmix64)
+uint64_t bench_rand(uint64_t *state);
+// Random permutation of list[0..n-1]
+void bench_shuffle(int *list, int n, uint64_t *state);
+// Median of vals[0..n-1], reorders vals
+double bench_median(double *vals, int n);
+// Medians of count resamples with replacement of samples[0..n-1]
+void bench_bootstrapMedian(const double *samples, int n, double *medians,
+			   int count, uint64_t *state);
+// Percentile interval [low, high] with the given level, e.g. 0.95. Reorders vals.
+void bench_interval(double *vals, int n, double level, double *low,
+		    double *high);
+
+#ifdef __cplusplus
+}
+#endif //__cplusplus
+
+#endif //BENCH_STATS_H_
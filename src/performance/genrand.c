@@ -11,10 +11,13 @@
  *             See the License for the specific language governing permissions and
  *             limitations under the License.
  * @author: Marc Fischer <marc.fischer@isw.uni-stuttgart.de>
- * @description: This file helps to generate random numers as input for the performance test.
+ * @description: This file helps to generate random numers as input for the performance test. The samples are
+ *               written to a binary file (see randfile.h). Usage: genrand [count] [file]
  */
 #include "pcg_variants.h"
+#include "randfile.h"
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 #include <errno.h>
 
@@ -23,15 +26,54 @@ int main(int argc, char **argv)
 	pcg32_random_t rng;
 	pcg32_srandom_r(&rng, 51616u, 888u);
 
-	FILE *pFile = fopen("rands.dat", "w");
+	uint64_t count = 500000;
+	const char *filename = "rands.dat";
+	if (argc > 1) {
+		count = strtoull(argv[1], NULL, 10);
+	}
+	if (argc > 2) {
+		filename = argv[2];
+	}
+
+	uint32_t *vals32 = malloc(sizeof(uint32_t) * count);
+	uint64_t *vals64 = malloc(sizeof(uint64_t) * count);
+	if (!vals32 || !vals64) {
+		printf("[Error] Could not allocate %lu samples\n", count);
+		return -1;
+	}
+	//The 32 bit samples are the same as of the former text file
+	for (uint64_t i = 0; i < count; i++) {
+		vals32[i] = pcg32_random_r(&rng);
+	}
+	for (uint64_t i = 0; i < count; i++) {
+		uint64_t hi = pcg32_random_r(&rng);
+		vals64[i] = (hi << 32) | pcg32_random_r(&rng);
+	}
+
+	randfile_header_t header;
+	size_t size;
+	randfile_layout(&header, count, &size);
+	header.checksum = randfile_checksum(vals32, vals64, count);
+
+	FILE *pFile = fopen(filename, "wb");
 	if (!pFile) {
 		printf("[Error] Could not open files: %s\n", strerror(errno));
 		return -2;
 	}
-
-	for (int i = 0; i < 500000; i++) {
-		uint32_t val = pcg32_random_r(&rng);
-		fprintf(pFile, "%u\n", val);
+	static const char zero[RANDFILE_ALIGN] = { 0 };
+	fwrite(&header, sizeof(header), 1, pFile);
+	fwrite(zero, 1, header.offset32 - sizeof(header), pFile);
+	fwrite(vals32, sizeof(uint32_t), count, pFile);
+	fwrite(zero, 1, header.offset64 - header.offset32 - count * sizeof(uint32_t),
+	       pFile);
+	if (fwrite(vals64, sizeof(uint64_t), count, pFile) != count) {
+		printf("[Error] Could not write %s: %s\n", filename,
+		       strerror(errno));
+		fclose(pFile);
+		return -2;
 	}
 	fclose(pFile);
-}
\ No newline at end of file
+	free(vals32);
+	free(vals64);
+	return 0;
+}
@@ -0,0 +1,106 @@
+/**
+ * @copyright: (c) 2022, Institute for Control Engineering of Machine Tools and Manufacturing Units,
+ *             University of Stuttgart
+ *             All rights reserved. Licensed under the Apache License, Version 2.0 (the "License");
+ *             you may not use this file except in compliance with the License.
+ *             You may obtain a copy of the License at
+ *                  http://www.apache.org/licenses/LICENSE-2.0
+ *             Unless required by applicable law or agreed to in writing, software
+ *             distributed under the License is distributed on an "AS IS" BASIS,
+ *             WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *             See the License for the specific language governing permissions and
+ *             limitations under the License.
+ * @author: Marc Fischer <marc.fischer@isw.uni-stuttgart.de>
+ * @description: Mapping of the binary input file of the performance test
+ */
+#include "randfile.h"
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#define RANDFILE_ALIGNUP(x) (((x) + RANDFILE_ALIGN - 1) & ~(uint64_t)(RANDFILE_ALIGN - 1))
+
+void randfile_layout(randfile_header_t *header, uint64_t count, size_t *size)
+{
+	memset(header, 0, sizeof(*header));
+	memcpy(header->magic, RANDFILE_MAGIC, sizeof(RANDFILE_MAGIC));
+	header->version = RANDFILE_VERSION;
+	header->headerSize = sizeof(randfile_header_t);
+	header->count = count;
+	header->offset32 = RANDFILE_ALIGNUP(sizeof(randfile_header_t));
+	header->offset64 =
+		RANDFILE_ALIGNUP(header->offset32 + count * sizeof(uint32_t));
+	*size = header->offset64 + count * sizeof(uint64_t);
+}
+
+uint64_t randfile_checksum(const uint32_t *vals32, const uint64_t *vals64,
+			   uint64_t count)
+{
+	uint64_t hash = 0xcbf29ce484222325ULL;
+	for (uint64_t i = 0; i < count; i++) {
+		hash = (hash ^ vals32[i]) * 0x100000001b3ULL;
+		hash = (hash ^ vals64[i]) * 0x100000001b3ULL;
+	}
+	return hash;
+}
+
+int randfile_map(randfile_t *file, const char *filename)
+{
+	memset(file, 0, sizeof(*file));
+	int fd = open(filename, O_RDONLY);
+	if (fd < 0) {
+		printf("[Error] Could not open files: %s\n", strerror(errno));
+		return -1;
+	}
+	struct stat st;
+	if (fstat(fd, &st) != 0 || (size_t)st.st_size < sizeof(randfile_header_t)) {
+		printf("[Error] %s is not an input file of genrand\n", filename);
+		close(fd);
+		return -2;
+	}
+	void *map = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if (map == MAP_FAILED) {
+		printf("[Error] Could not map %s: %s\n", filename, strerror(errno));
+		return -1;
+	}
+
+	const randfile_header_t *header = map;
+	randfile_header_t layout;
+	size_t size;
+	randfile_layout(&layout, header->count, &size);
+	if (memcmp(header->magic, RANDFILE_MAGIC, sizeof(RANDFILE_MAGIC)) != 0 ||
+	    header->headerSize != sizeof(randfile_header_t) ||
+	    header->offset32 != layout.offset32 ||
+	    header->offset64 != layout.offset64 || size > (size_t)st.st_size) {
+		printf("[Error] %s is not an input file of genrand, regenerate it\n",
+		       filename);
+		munmap(map, st.st_size);
+		return -2;
+	}
+	if (header->version != RANDFILE_VERSION) {
+		printf("[Error] %s has version %u, expected %u\n", filename,
+		       header->version, RANDFILE_VERSION);
+		munmap(map, st.st_size);
+		return -2;
+	}
+	file->map = map;
+	file->size = st.st_size;
+	file->count = header->count;
+	file->checksum = header->checksum;
+	file->vals32 = (const uint32_t *)((const char *)map + header->offset32);
+	file->vals64 = (const uint64_t *)((const char *)map + header->offset64);
+	return 0;
+}
+
+void randfile_unmap(randfile_t *file)
+{
+	if (file->map != NULL) {
+		munmap(file->map, file->size);
+	}
+	memset(file, 0, sizeof(*file));
+}
@@ -0,0 +1,65 @@
+/**
+ * @copyright: (c) 2022, Institute for Control Engineering of Machine Tools and Manufacturing Units,
+ *             University of Stuttgart
+ *             All rights reserved. Licensed under the Apache License, Version 2.0 (the "License");
+ *             you may not use this file except in compliance with the License.
+ *             You may obtain a copy of the License at
+ *                  http://www.apache.org/licenses/LICENSE-2.0
+ *             Unless required by applicable law or agreed to in writing, software
+ *             distributed under the License is distributed on an "AS IS" BASIS,
+ *             WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *             See the License for the specific language governing permissions and
+ *             limitations under the License.
+ * @author: Marc Fischer <marc.fischer@isw.uni-stuttgart.de>
+ * @description: Binary input file of the performance test, written by genrand and memory mapped by the
+ *               benchmark. The header is followed by count 32 bit and count 64 bit samples in native byte
+ *               order, each array is aligned to RANDFILE_ALIGN bytes.
+ */
+#ifndef RANDFILE_H_
+#define RANDFILE_H_
+#ifdef __cplusplus
+extern "C" {
+#endif //__cplusplus
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define RANDFILE_MAGIC "ACRANDS"
+#define RANDFILE_VERSION 1
+#define RANDFILE_ALIGN 64
+
+typedef struct {
+	char magic[8]; //RANDFILE_MAGIC
+	uint32_t version; //RANDFILE_VERSION
+	uint32_t headerSize; //sizeof(randfile_header_t), detects another byte order or layout
+	uint64_t count; //Samples per width
+	uint64_t offset32; //Byte offset of the 32 bit samples
+	uint64_t offset64; //Byte offset of the 64 bit samples
+	uint64_t checksum; //randfile_checksum of both arrays
+	uint64_t reserved[2];
+} randfile_header_t;
+
+typedef struct {
+	const uint32_t *vals32;
+	const uint64_t *vals64;
+	uint64_t count;
+	uint64_t checksum;
+	void *map;
+	size_t size;
+} randfile_t;
+
+// Offsets of the arrays of a file with count samples and the total file size
+void randfile_layout(randfile_header_t *header, uint64_t count,
+		     size_t *size);
+// FNV-1a of the 32 and 64 bit samples
+uint64_t randfile_checksum(const uint32_t *vals32, const uint64_t *vals64,
+			   uint64_t count);
+// Maps the file read only. Returns 0 on success, -1 if the file can't be mapped, -2 if it isn't a valid file.
+int randfile_map(randfile_t *file, const char *filename);
+void randfile_unmap(randfile_t *file);
+
+#ifdef __cplusplus
+}
+#endif //__cplusplus
+
+#endif //RANDFILE_H_